@@ -478,7 +478,7 @@ class AVLTree {
         } else {
           tmp->parent_->left_ = NULL;
         }
-        delete tmp;
+        deallocateNode(tmp);
       }
     }
   }
@@ -503,7 +503,7 @@ class AVLTree {
       substitute_src->parent_->joinNode(substitute_src->isRightChild(),
                                         substitute_src->left_);
 
-      delete substitute_src;
+      deallocateNode(substitute_src);
     } else if (target->right_) {
       target->parent_->joinNode(target->isRightChild(), target->right_);
     } else {
@@ -514,7 +514,7 @@ class AVLTree {
       }
     }
 
-    delete target;
+    deallocateNode(target);
     balanceNode(featured);
     return true;
   }
@@ -611,6 +611,11 @@ class AVLTree {
     return res;
   }
 
+  void deallocateNode(Node* node) {
+    allocator_.destroy(node);
+    allocator_.deallocate(node, 1);
+  }
+
   bool nodeRangeComp(Node* first, Node* second, const Key key) {
     return comp_(first->data_.first, key) && comp_(key, second->data_.first);
   }
@@ -0,0 +1,25 @@
+#ifndef ALIGNED_BUFFER_HPP
+#define ALIGNED_BUFFER_HPP
+
+#include <cstddef>
+
+namespace ft {
+
+template <class T, std::size_t N>
+union aligned_buffer {
+  unsigned char bytes_[sizeof(T) * (N ? N : 1)];
+  long double long_double_;
+  long long_;
+  void* pointer_;
+  void (*function_)();
+
+  aligned_buffer() {}
+
+  T* data() { return reinterpret_cast<T*>(bytes_); }
+  const T* data() const { return reinterpret_cast<const T*>(bytes_); }
+};
+
+}  // namespace ft
+
+#endif /* ************************************************** ALIGNED_BUFFER_H \
+        */
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+#include <sched.h>
+
+#include <cstddef>
+
+namespace ft {
+
+// C++98 has no memory model, so the lock-free containers use the
+// __atomic builtins that gcc and clang provide for word-sized integers and
+// pointers.
+
+static const std::size_t cache_line_size = 64;
+
+template <class T>
+T atomic_load_relaxed(const T* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+}
+
+template <class T>
+T atomic_load_acquire(const T* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+template <class T>
+void atomic_store_relaxed(T* ptr, T value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+}
+
+template <class T>
+void atomic_store_release(T* ptr, T value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+template <class T>
+T atomic_fetch_add(T* ptr, T value) {
+  return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+
+// On failure, expected is updated with the value currently stored.
+template <class T>
+bool atomic_compare_exchange(T* ptr, T* expected, T desired) {
+  return __atomic_compare_exchange_n(ptr, expected, desired, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+inline void atomic_thread_fence() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
+// Spins with an exponentially growing number of pauses, then falls back to
+// yielding so a waiter does not starve the thread it waits for when both
+// share a CPU.
+class backoff {
+ private:
+  unsigned count_;
+
+ public:
+  backoff() : count_(0) {}
+
+  void pause() {
+    if (count_ < 6) {
+      for (unsigned i = 0; i < (1u << count_); i++) {
+        cpu_relax();
+      }
+      count_++;
+    } else {
+      sched_yield();
+    }
+  }
+
+  void reset() { count_ = 0; }
+};
+
+}  // namespace ft
+
+#endif /* ********************************************************** ATOMIC_H \
+        */
\ No newline at end of file
@@ -0,0 +1,189 @@
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "aligned_buffer.hpp"
+#include "atomic.hpp"
+
+namespace ft {
+
+// Lock-free LIFO for any number of pushing and popping threads (Treiber
+// stack). Nodes live in chunks that are only released by the destructor, so
+// a popping thread may always read a node it lost the race for. Nodes are
+// addressed by a 32-bit index; the list heads pack that index with a 32-bit
+// version tag bumped by every update, which makes a compare-exchange fail
+// when a node was popped and pushed back in between (ABA). Popped nodes are
+// recycled through a second lock-free list instead of the allocator.
+template <class T, class Allocator = std::allocator<T> >
+class concurrent_stack {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef std::size_t size_type;
+
+ private:
+  typedef unsigned int index_type;
+  typedef unsigned long long tagged_type;
+
+  struct node {
+    aligned_buffer<T, 1> value;
+    index_type next;
+  };
+
+  typedef typename Allocator::template rebind<node>::other node_allocator;
+
+  static const index_type npos = UINT_MAX;
+  static const size_type first_chunk_size = 64;
+  static const size_type chunk_count = 26;
+
+  char pad0_[cache_line_size];
+  tagged_type head_;
+  char pad1_[cache_line_size - sizeof(tagged_type)];
+  tagged_type free_;
+  char pad2_[cache_line_size - sizeof(tagged_type)];
+  size_type next_index_;
+  // Bumped by every new node, so it must not share a line with chunks_,
+  // which every push and pop reads.
+  char pad3_[cache_line_size - sizeof(size_type)];
+  node* chunks_[chunk_count];
+  allocator_type allocater_;
+  node_allocator node_allocater_;
+
+ public:
+  explicit concurrent_stack(const Allocator& alloc = Allocator())
+      : head_(make_tagged(npos, 0)),
+        free_(make_tagged(npos, 0)),
+        next_index_(0),
+        allocater_(alloc),
+        node_allocater_(alloc) {
+    for (size_type k = 0; k < chunk_count; k++) {
+      chunks_[k] = NULL;
+    }
+  }
+
+  ~concurrent_stack() {
+    for (index_type i = index_of(head_); i != npos; i = node_at(i)->next) {
+      allocater_.destroy(node_at(i)->value.data());
+    }
+    for (size_type k = 0; k < chunk_count; k++) {
+      if (chunks_[k] != NULL) {
+        node_allocater_.deallocate(chunks_[k], first_chunk_size << k);
+      }
+    }
+  }
+
+  // Capacity-------------------------------------------
+
+  // Only a snapshot when other threads are running.
+  bool empty() const { return index_of(atomic_load_acquire(&head_)) == npos; }
+
+  // Modifiers------------------------------------------
+
+  void push(const value_type& val) {
+    index_type i = acquire_node();
+    allocater_.construct(node_at(i)->value.data(), val);
+    push_index(&head_, i);
+  }
+
+  bool try_pop(value_type& out) {
+    index_type i = pop_index(&head_);
+    if (i == npos) return false;
+
+    T* value = node_at(i)->value.data();
+    out = *value;
+    allocater_.destroy(value);
+    push_index(&free_, i);
+    return true;
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  concurrent_stack(const concurrent_stack&);
+  concurrent_stack& operator=(const concurrent_stack&);
+
+  static tagged_type make_tagged(index_type index, tagged_type tag) {
+    return (tag << 32) | index;
+  }
+
+  static index_type index_of(tagged_type tagged) {
+    return static_cast<index_type>(tagged);
+  }
+
+  static tagged_type next_tag(tagged_type tagged) {
+    return (tagged >> 32) + 1;
+  }
+
+  // Chunk k holds first_chunk_size << k nodes, so the total capacity doubles
+  // with every chunk and 26 chunks cover the 32-bit index space.
+  node* node_at(index_type i) const {
+    size_type q = i / first_chunk_size + 1;
+    size_type k = sizeof(unsigned long) * CHAR_BIT - 1 - __builtin_clzl(q);
+    size_type offset = i - first_chunk_size * ((size_type(1) << k) - 1);
+    return atomic_load_acquire(&chunks_[k]) + offset;
+  }
+
+  index_type acquire_node() {
+    index_type i = pop_index(&free_);
+    if (i != npos) return i;
+
+    size_type n = atomic_fetch_add(&next_index_, size_type(1));
+    if (n >= first_chunk_size * ((size_type(1) << chunk_count) - 1)) {
+      throw std::length_error("ft::concurrent_stack push() length_error");
+    }
+    size_type k = sizeof(unsigned long) * CHAR_BIT - 1 -
+                  __builtin_clzl(n / first_chunk_size + 1);
+    if (atomic_load_acquire(&chunks_[k]) == NULL) {
+      node* chunk = node_allocater_.allocate(first_chunk_size << k);
+      node* expected = NULL;
+      if (!atomic_compare_exchange(&chunks_[k], &expected, chunk)) {
+        node_allocater_.deallocate(chunk, first_chunk_size << k);
+      }
+    }
+    return static_cast<index_type>(n);
+  }
+
+  void push_index(tagged_type* list, index_type i) {
+    node* n = node_at(i);
+    tagged_type old = atomic_load_acquire(list);
+    do {
+      atomic_store_relaxed(&n->next, index_of(old));
+    } while (!atomic_compare_exchange(list, &old,
+                                      make_tagged(i, next_tag(old))));
+  }
+
+  index_type pop_index(tagged_type* list) {
+    tagged_type old = atomic_load_acquire(list);
+    backoff wait;
+    while (index_of(old) != npos) {
+      index_type next = atomic_load_relaxed(&node_at(index_of(old))->next);
+      if (atomic_compare_exchange(list, &old,
+                                  make_tagged(next, next_tag(old)))) {
+        return index_of(old);
+      }
+      wait.pause();
+    }
+    return npos;
+  }
+};
+
+template <class T, class Alloc>
+const typename concurrent_stack<T, Alloc>::index_type
+    concurrent_stack<T, Alloc>::npos;
+
+template <class T, class Alloc>
+const typename concurrent_stack<T, Alloc>::size_type
+    concurrent_stack<T, Alloc>::first_chunk_size;
+
+template <class T, class Alloc>
+const typename concurrent_stack<T, Alloc>::size_type
+    concurrent_stack<T, Alloc>::chunk_count;
+
+}  // namespace ft
+
+#endif /* ************************************************ CONCURRENT_STACK_H \
+        */
\ No newline at end of file
@@ -0,0 +1,547 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "enable_if.hpp"
+#include "equal.hpp"
+#include "iterator.hpp"
+#include "iterator_traits.hpp"
+#include "lexicographical_compare.hpp"
+#include "reverse_iterator.hpp"
+
+namespace ft {
+
+template <class T>
+struct deque_block_size {
+  static const std::size_t value = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+};
+
+template <class T>
+const std::size_t deque_block_size<T>::value;
+
+template <class T, class Pointer, class Reference>
+class deque_iterator
+    : public iterator<std::random_access_iterator_tag, T, std::ptrdiff_t,
+                      Pointer, Reference> {
+ public:
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Pointer pointer;
+  typedef Reference reference;
+  typedef std::random_access_iterator_tag iterator_category;
+
+ private:
+  T** map_;
+  std::size_t index_;
+
+ public:
+  deque_iterator() : map_(NULL), index_(0) {}
+  deque_iterator(T** map, std::size_t index) : map_(map), index_(index) {}
+  template <class P, class R>
+  deque_iterator(const deque_iterator<T, P, R>& it)
+      : map_(it.map()), index_(it.index()) {}
+
+  reference operator*() const {
+    return map_[index_ / deque_block_size<T>::value]
+               [index_ % deque_block_size<T>::value];
+  }
+
+  pointer operator->() const { return &(operator*()); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  deque_iterator& operator++() {
+    ++index_;
+    return *this;
+  }
+
+  deque_iterator operator++(int) {
+    deque_iterator tmp = *this;
+    ++index_;
+    return tmp;
+  }
+
+  deque_iterator& operator--() {
+    --index_;
+    return *this;
+  }
+
+  deque_iterator operator--(int) {
+    deque_iterator tmp = *this;
+    --index_;
+    return tmp;
+  }
+
+  deque_iterator& operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  deque_iterator& operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  deque_iterator operator+(difference_type n) const {
+    return deque_iterator(map_, index_ + n);
+  }
+
+  deque_iterator operator-(difference_type n) const {
+    return deque_iterator(map_, index_ - n);
+  }
+
+  T** map() const { return map_; }
+  std::size_t index() const { return index_; }
+};
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator==(const deque_iterator<T, P1, R1>& lhs,
+                const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() == rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator!=(const deque_iterator<T, P1, R1>& lhs,
+                const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() != rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator<(const deque_iterator<T, P1, R1>& lhs,
+               const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() < rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator>(const deque_iterator<T, P1, R1>& lhs,
+               const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() > rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator<=(const deque_iterator<T, P1, R1>& lhs,
+                const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() <= rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator>=(const deque_iterator<T, P1, R1>& lhs,
+                const deque_iterator<T, P2, R2>& rhs) {
+  return lhs.index() >= rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+std::ptrdiff_t operator-(const deque_iterator<T, P1, R1>& lhs,
+                         const deque_iterator<T, P2, R2>& rhs) {
+  return static_cast<std::ptrdiff_t>(lhs.index()) -
+         static_cast<std::ptrdiff_t>(rhs.index());
+}
+
+template <class T, class P, class R>
+deque_iterator<T, P, R> operator+(std::ptrdiff_t n,
+                                  const deque_iterator<T, P, R>& it) {
+  return it + n;
+}
+
+// Elements live in fixed-size blocks referenced from a map of block pointers.
+// Growing only ever reallocates the map, so elements never move and
+// references to them stay valid across push_front/push_back.
+template <class T, class Allocator = std::allocator<T> >
+class deque {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef deque_iterator<T, pointer, reference> iterator;
+  typedef deque_iterator<T, const_pointer, const_reference> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  static const size_type block_size = deque_block_size<T>::value;
+
+ private:
+  typedef typename Allocator::template rebind<pointer>::other map_allocator;
+
+ protected:
+  pointer* map_;
+  size_type map_size_;
+  size_type head_;
+  size_type size_;
+  allocator_type allocater_;
+  map_allocator map_allocater_;
+
+ public:
+  deque()
+      : map_(NULL),
+        map_size_(0),
+        head_(0),
+        size_(0),
+        allocater_(allocator_type()),
+        map_allocater_(allocater_){};
+
+  explicit deque(const Allocator& alloc)
+      : map_(NULL),
+        map_size_(0),
+        head_(0),
+        size_(0),
+        allocater_(alloc),
+        map_allocater_(alloc){};
+
+  explicit deque(size_type count, const T& value = T(),
+                 const Allocator& alloc = Allocator())
+      : map_(NULL),
+        map_size_(0),
+        head_(0),
+        size_(0),
+        allocater_(alloc),
+        map_allocater_(alloc) {
+    resize(count, value);
+  };
+
+  template <class InputIt>
+  deque(InputIt first,
+        typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+        const Allocator& alloc = Allocator())
+      : map_(NULL),
+        map_size_(0),
+        head_(0),
+        size_(0),
+        allocater_(alloc),
+        map_allocater_(alloc) {
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  };
+
+  deque(const deque& other)
+      : map_(NULL),
+        map_size_(0),
+        head_(0),
+        size_(0),
+        allocater_(other.allocater_),
+        map_allocater_(other.map_allocater_) {
+    *this = other;
+  };
+
+  ~deque() {
+    clear();
+    release_blocks(0, map_size_);
+    if (map_ != NULL) {
+      map_allocater_.deallocate(map_, map_size_);
+    }
+  }
+
+  deque& operator=(const deque& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  // Iterators-------------------------------------------
+
+  iterator begin() { return iterator(map_, head_); }
+  const_iterator begin() const { return const_iterator(map_, head_); }
+
+  iterator end() { return iterator(map_, head_ + size_); }
+  const_iterator end() const { return const_iterator(map_, head_ + size_); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  };
+
+  reverse_iterator rend() { return reverse_iterator(begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  };
+
+  // Capacity-------------------------------------------
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::min<size_type>(std::numeric_limits<difference_type>::max(),
+                               allocater_.max_size());
+  }
+
+  void resize(size_type n, value_type val = value_type()) {
+    while (size_ > n) {
+      pop_back();
+    }
+    while (size_ < n) {
+      push_back(val);
+    }
+  };
+
+  bool empty() const { return size_ == 0; };
+
+  void shrink_to_fit() {
+    size_type first_block = head_ / block_size;
+    size_type last_block = size_ ? (head_ + size_ - 1) / block_size + 1
+                                 : first_block;
+    release_blocks(0, first_block);
+    release_blocks(last_block, map_size_);
+  }
+
+  // Element access-------------------------------------
+
+  reference operator[](size_type pos) { return *slot(head_ + pos); }
+
+  const_reference operator[](size_type pos) const {
+    return *slot(head_ + pos);
+  }
+
+  reference at(size_type pos) {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::deque at() out_of_range");
+    }
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::deque at() out_of_range");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() { return *slot(head_); }
+
+  const_reference front() const { return *slot(head_); }
+
+  reference back() { return *slot(head_ + size_ - 1); }
+
+  const_reference back() const { return *slot(head_ + size_ - 1); }
+
+  // Modifiers------------------------------------------
+
+  void assign(size_type count, const T& value) {
+    value_type tmp(value);
+    clear();
+    resize(count, tmp);
+  }
+
+  template <class InputIt>
+  void assign(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    clear();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  void push_back(const value_type& val) {
+    if (head_ + size_ == map_size_ * block_size) {
+      value_type tmp(val);
+      grow_map();
+      construct(ensure_block(head_ + size_), tmp);
+    } else {
+      construct(ensure_block(head_ + size_), val);
+    }
+    size_++;
+  }
+
+  void push_front(const value_type& val) {
+    if (head_ == 0) {
+      value_type tmp(val);
+      grow_map();
+      construct(ensure_block(head_ - 1), tmp);
+    } else {
+      construct(ensure_block(head_ - 1), val);
+    }
+    head_--;
+    size_++;
+  }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    size_--;
+    destroy(slot(head_ + size_));
+  }
+
+  void pop_front() {
+    if (size_ == 0) return;
+    destroy(slot(head_));
+    head_++;
+    size_--;
+  }
+
+  iterator insert(iterator pos, const value_type& value) {
+    difference_type offset = pos - begin();
+    insert(pos, 1, value);
+    return begin() + offset;
+  }
+
+  void insert(iterator pos, size_type count, const value_type& value) {
+    difference_type offset = pos - begin();
+    value_type tmp(value);
+    for (size_type i = 0; i < count; i++) {
+      push_back(tmp);
+    }
+    std::rotate(begin() + offset, end() - count, end());
+  }
+
+  template <class InputIt>
+  void insert(
+      iterator pos,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+      InputIt last) {
+    difference_type offset = pos - begin();
+    size_type old_size = size_;
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+    std::rotate(begin() + offset, begin() + old_size, end());
+  }
+
+  iterator erase(iterator position) { return erase(position, position + 1); };
+
+  iterator erase(iterator first, iterator last) {
+    difference_type offset = first - begin();
+    difference_type len = last - first;
+
+    if (offset < static_cast<difference_type>(size_) - (offset + len)) {
+      std::copy_backward(begin(), first, last);
+      for (difference_type i = 0; i < len; i++) {
+        pop_front();
+      }
+    } else {
+      std::copy(last, end(), first);
+      for (difference_type i = 0; i < len; i++) {
+        pop_back();
+      }
+    }
+    return begin() + offset;
+  };
+
+  void clear() {
+    while (size_ != 0) {
+      pop_back();
+    }
+  }
+
+  void swap(deque& other) {
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(allocater_, other.allocater_);
+    std::swap(map_allocater_, other.map_allocater_);
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  pointer slot(size_type index) const {
+    return map_[index / block_size] + index % block_size;
+  }
+
+  void construct(pointer ptr, const_reference value) {
+    allocater_.construct(ptr, value);
+  }
+
+  void destroy(pointer ptr) { allocater_.destroy(ptr); }
+
+  pointer ensure_block(size_type index) {
+    pointer& block = map_[index / block_size];
+    if (block == NULL) {
+      block = allocater_.allocate(block_size);
+    }
+    return block + index % block_size;
+  }
+
+  void release_blocks(size_type first, size_type last) {
+    for (; first < last; first++) {
+      if (map_[first] != NULL) {
+        allocater_.deallocate(map_[first], block_size);
+        map_[first] = NULL;
+      }
+    }
+  }
+
+  // Moves the block pointers of the live range to the middle of a map with
+  // room on both sides. Blocks outside the live range are released.
+  void grow_map() {
+    size_type first_block = head_ / block_size;
+    size_type used_blocks =
+        size_ ? (head_ + size_ - 1) / block_size + 1 - first_block : 0;
+    size_type new_map_size = std::max<size_type>(8, used_blocks * 2 + 2);
+    size_type new_first = (new_map_size - used_blocks) / 2;
+
+    pointer* new_map = map_allocater_.allocate(new_map_size);
+    std::fill(new_map, new_map + new_map_size, pointer(NULL));
+    if (map_ != NULL) {
+      std::copy(map_ + first_block, map_ + first_block + used_blocks,
+                new_map + new_first);
+      std::fill(map_ + first_block, map_ + first_block + used_blocks,
+                pointer(NULL));
+      release_blocks(0, map_size_);
+      map_allocater_.deallocate(map_, map_size_);
+    }
+
+    head_ = new_first * block_size + head_ % block_size;
+    if (size_ == 0) {
+      head_ = new_map_size / 2 * block_size;
+    }
+    map_ = new_map;
+    map_size_ = new_map_size;
+  }
+};
+
+template <class T, class Alloc>
+const typename deque<T, Alloc>::size_type deque<T, Alloc>::block_size;
+
+template <class T, class Alloc>
+bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, class Alloc>
+bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, class Alloc>
+bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs > rhs);
+}
+
+template <class T, class Alloc>
+bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, class Alloc>
+bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, class Alloc>
+void swap(deque<T, Alloc>& x, deque<T, Alloc>& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif /* *********************************************************** DEQUE_H \
+        */
\ No newline at end of file
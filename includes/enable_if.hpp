@@ -64,6 +64,54 @@ template <class T>
 struct is_integral
     : public is_integral_helper<typename remove_cv<T>::type>::type {};
 
+template <typename T>
+struct is_floating_point_helper : public false_type {};
+
+template <>
+struct is_floating_point_helper<float> : public true_type {};
+template <>
+struct is_floating_point_helper<double> : public true_type {};
+template <>
+struct is_floating_point_helper<long double> : public true_type {};
+
+template <class T>
+struct is_floating_point
+    : public is_floating_point_helper<typename remove_cv<T>::type>::type {};
+
+template <typename T>
+struct is_pointer_helper : public false_type {};
+
+template <typename T>
+struct is_pointer_helper<T*> : public true_type {};
+
+template <class T>
+struct is_pointer
+    : public is_pointer_helper<typename remove_cv<T>::type>::type {};
+
+template <class T>
+struct is_arithmetic
+    : public integral_constant<bool, is_integral<T>::value ||
+                                         is_floating_point<T>::value> {};
+
+// Enums and member pointers cannot be detected without compiler support, so
+// they are conservatively reported as non-scalar.
+template <class T>
+struct is_scalar
+    : public integral_constant<bool, is_arithmetic<T>::value ||
+                                         is_pointer<T>::value> {};
+
+// Defaults to is_scalar; specialize it for trivially destructible aggregates
+// to let containers skip their destructor loops.
+template <class T>
+struct is_trivially_destructible
+    : public integral_constant<bool, is_scalar<T>::value> {};
+
+template <class T, class U>
+struct is_same : public false_type {};
+
+template <class T>
+struct is_same<T, T> : public true_type {};
+
 template <bool, typename T = void>
 struct enable_if {};
 
@@ -1,10 +1,40 @@
 #ifndef EQUAL_HPP
 #define EQUAL_HPP
 
+#include <cstddef>
+#include <cstring>
+
+#include "enable_if.hpp"
+#include "random_access_iterator.hpp"
+
 namespace ft {
 
+// Integral ranges of the same type compare equal exactly when their bytes do,
+// so contiguous ranges of them can be handed to memcmp.
+template <class T, class U>
+struct is_bytewise_comparable
+    : public integral_constant<
+          bool, is_integral<T>::value &&
+                    is_same<typename remove_cv<T>::type,
+                            typename remove_cv<U>::type>::value> {};
+
+template <class T, class U>
+T* mismatch_bytewise(T* first1, T* last1, U* first2) {
+  const std::ptrdiff_t block = 256 / sizeof(T) ? 256 / sizeof(T) : 1;
+  while (last1 - first1 >= block &&
+         std::memcmp(first1, first2, block * sizeof(T)) == 0) {
+    first1 += block;
+    first2 += block;
+  }
+  while (first1 != last1 && *first1 == *first2) {
+    ++first1;
+    ++first2;
+  }
+  return first1;
+}
+
 template <class InputIt1, class InputIt2>
-bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+bool equal_loop(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
   for (; first1 != last1; ++first1, ++first2) {
     if (!(*first1 == *first2)) {
       return false;
@@ -13,6 +43,34 @@ bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
   return true;
 }
 
+template <class T, class U>
+bool equal_contiguous(T* first1, T* last1, U* first2, true_type) {
+  if (first1 == last1) return true;
+  return std::memcmp(first1, first2, (last1 - first1) * sizeof(T)) == 0;
+}
+
+template <class T, class U>
+bool equal_contiguous(T* first1, T* last1, U* first2, false_type) {
+  return equal_loop(first1, last1, first2);
+}
+
+template <class InputIt1, class InputIt2>
+bool equal_unwrapped(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  return equal_loop(first1, last1, first2);
+}
+
+template <class T, class U>
+bool equal_unwrapped(T* first1, T* last1, U* first2) {
+  return equal_contiguous(first1, last1, first2,
+                          is_bytewise_comparable<T, U>());
+}
+
+template <class InputIt1, class InputIt2>
+bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+  return equal_unwrapped(unwrap_iterator(first1), unwrap_iterator(last1),
+                         unwrap_iterator(first2));
+}
+
 template <class InputIt1, class InputIt2, class BinaryPredicate>
 bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2,
            BinaryPredicate p) {
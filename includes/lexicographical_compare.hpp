@@ -1,11 +1,13 @@
 #ifndef LEXICOGRAPHICAL_COMPARE_HPP
 #define LEXICOGRAPHICAL_COMPARE_HPP
 
+#include "equal.hpp"
+
 namespace ft {
 
 template <class InputIt1, class InputIt2>
-bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2,
-                             InputIt2 last2) {
+bool lexicographical_compare_loop(InputIt1 first1, InputIt1 last1,
+                                  InputIt2 first2, InputIt2 last2) {
   for (; (first1 != last1) && (first2 != last2); ++first1, (void)++first2) {
     if (*first1 < *first2) return true;
     if (*first2 < *first1) return false;
@@ -13,6 +15,47 @@ bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2,
   return (first1 == last1) && (first2 != last2);
 }
 
+template <class T, class U>
+bool lexicographical_compare_contiguous(T* first1, T* last1, U* first2,
+                                        U* last2, true_type) {
+  std::ptrdiff_t len1 = last1 - first1;
+  std::ptrdiff_t len2 = last2 - first2;
+  T* common_last = first1 + (len1 < len2 ? len1 : len2);
+  T* mismatch = mismatch_bytewise(first1, common_last, first2);
+
+  if (mismatch != common_last) {
+    return *mismatch < first2[mismatch - first1];
+  }
+  return len1 < len2;
+}
+
+template <class T, class U>
+bool lexicographical_compare_contiguous(T* first1, T* last1, U* first2,
+                                        U* last2, false_type) {
+  return lexicographical_compare_loop(first1, last1, first2, last2);
+}
+
+template <class InputIt1, class InputIt2>
+bool lexicographical_compare_unwrapped(InputIt1 first1, InputIt1 last1,
+                                       InputIt2 first2, InputIt2 last2) {
+  return lexicographical_compare_loop(first1, last1, first2, last2);
+}
+
+template <class T, class U>
+bool lexicographical_compare_unwrapped(T* first1, T* last1, U* first2,
+                                       U* last2) {
+  return lexicographical_compare_contiguous(first1, last1, first2, last2,
+                                            is_bytewise_comparable<T, U>());
+}
+
+template <class InputIt1, class InputIt2>
+bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                             InputIt2 last2) {
+  return lexicographical_compare_unwrapped(
+      unwrap_iterator(first1), unwrap_iterator(last1), unwrap_iterator(first2),
+      unwrap_iterator(last2));
+}
+
 template <class InputIt1, class InputIt2, class Compare>
 bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2,
                              InputIt2 last2, Compare comp) {
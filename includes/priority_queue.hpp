@@ -0,0 +1,342 @@
+#ifndef PRIORITY_QUEUE_HPP
+#define PRIORITY_QUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+#include "enable_if.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// Max-heap with Arity children per node (the greatest element according to
+// Compare is on top). A wider node makes the tree shallower and keeps the
+// children of one node next to each other in memory, trading a few more
+// comparisons per level in pop() for fewer cache misses.
+template <class T, class Container = ft::vector<T>,
+          class Compare = std::less<typename Container::value_type>,
+          std::size_t Arity = 4>
+class priority_queue {
+ public:
+  typedef Container container_type;
+  typedef Compare value_compare;
+  typedef typename Container::value_type value_type;
+  typedef typename Container::size_type size_type;
+  typedef typename Container::reference reference;
+  typedef typename Container::const_reference const_reference;
+
+  static const std::size_t arity = Arity;
+
+ protected:
+  container_type c;
+  value_compare comp;
+
+ public:
+  explicit priority_queue(const Compare& compare = Compare(),
+                          const Container& cont = Container())
+      : c(cont), comp(compare) {
+    make_heap();
+  }
+
+  template <class InputIt>
+  priority_queue(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+      const Compare& compare = Compare(),
+      const Container& cont = Container())
+      : c(cont), comp(compare) {
+    c.insert(c.end(), first, last);
+    make_heap();
+  }
+
+  ~priority_queue() {}
+
+  priority_queue& operator=(const priority_queue& other) {
+    if (this != &other) {
+      c = other.c;
+      comp = other.comp;
+    }
+    return *this;
+  }
+
+  // Element access--------------------------------------
+
+  const_reference top() const { return c.front(); }
+
+  // Capacity--------------------------------------------
+
+  bool empty() const { return c.empty(); }
+
+  size_type size() const { return c.size(); }
+
+  // Modifiers-------------------------------------------
+
+  void push(const value_type& val) {
+    c.push_back(val);
+    sift_up(c.size() - 1);
+  }
+
+  // The last element almost always belongs near the bottom again, so the hole
+  // left at the root is first moved down to a leaf along the greatest
+  // children and the last element is then sifted up from there. This saves
+  // the comparison against the moved element on every level.
+  void pop() {
+    if (c.empty()) return;
+    size_type n = c.size() - 1;
+    size_type hole = 0;
+    for (;;) {
+      size_type first_child = hole * Arity + 1;
+      if (first_child >= n) break;
+      size_type last_child = std::min(first_child + Arity, n);
+      size_type best = first_child;
+      for (size_type i = first_child + 1; i < last_child; i++) {
+        if (comp(c[best], c[i])) best = i;
+      }
+      c[hole] = c[best];
+      hole = best;
+    }
+    if (hole != n) {
+      c[hole] = c[n];
+    }
+    c.pop_back();
+    if (hole != n) {
+      sift_up(hole);
+    }
+  }
+
+  void swap(priority_queue& other) {
+    c.swap(other.c);
+    std::swap(comp, other.comp);
+  }
+
+ private:
+  void make_heap() {
+    if (c.size() < 2) return;
+    for (size_type i = (c.size() - 2) / Arity + 1; i != 0;) {
+      sift_down(--i);
+    }
+  }
+
+  void sift_up(size_type pos) {
+    value_type value = c[pos];
+    while (pos != 0) {
+      size_type parent = (pos - 1) / Arity;
+      if (!comp(c[parent], value)) break;
+      c[pos] = c[parent];
+      pos = parent;
+    }
+    c[pos] = value;
+  }
+
+  void sift_down(size_type pos) {
+    value_type value = c[pos];
+    size_type n = c.size();
+    for (;;) {
+      size_type first_child = pos * Arity + 1;
+      if (first_child >= n) break;
+      size_type last_child = std::min(first_child + Arity, n);
+      size_type best = first_child;
+      for (size_type i = first_child + 1; i < last_child; i++) {
+        if (comp(c[best], c[i])) best = i;
+      }
+      if (!comp(value, c[best])) break;
+      c[pos] = c[best];
+      pos = best;
+    }
+    c[pos] = value;
+  }
+};
+
+template <class T, class Container, class Compare, std::size_t Arity>
+const std::size_t priority_queue<T, Container, Compare, Arity>::arity;
+
+template <class T, class Container, class Compare, std::size_t Arity>
+void swap(priority_queue<T, Container, Compare, Arity>& x,
+          priority_queue<T, Container, Compare, Arity>& y) {
+  x.swap(y);
+}
+
+// d-ary heap whose elements can be found again through the handle returned
+// by push(). A handle stays valid until its element is popped or erased and
+// is then reused by a later push().
+template <class T, class Compare = std::less<T>, std::size_t Arity = 4>
+class indexed_priority_queue {
+ public:
+  typedef T value_type;
+  typedef Compare value_compare;
+  typedef std::size_t size_type;
+  typedef std::size_t handle_type;
+  typedef const T& const_reference;
+
+  static const std::size_t arity = Arity;
+
+ private:
+  static const size_type npos = static_cast<size_type>(-1);
+
+  struct slot {
+    T value;
+    size_type pos;
+
+    slot(const T& v, size_type p) : value(v), pos(p) {}
+  };
+
+ protected:
+  ft::vector<handle_type> heap_;
+  ft::vector<slot> slots_;
+  ft::vector<handle_type> free_;
+  value_compare comp;
+
+ public:
+  explicit indexed_priority_queue(const Compare& compare = Compare())
+      : comp(compare) {}
+
+  // Element access--------------------------------------
+
+  const_reference top() const { return slots_[heap_.front()].value; }
+
+  handle_type top_handle() const { return heap_.front(); }
+
+  const_reference value(handle_type h) const {
+    check_handle(h, "ft::indexed_priority_queue value() out_of_range");
+    return slots_[h].value;
+  }
+
+  bool contains(handle_type h) const {
+    return h < slots_.size() && slots_[h].pos != npos;
+  }
+
+  // Capacity--------------------------------------------
+
+  bool empty() const { return heap_.empty(); }
+
+  size_type size() const { return heap_.size(); }
+
+  void reserve(size_type n) {
+    heap_.reserve(n);
+    slots_.reserve(n);
+  }
+
+  // Modifiers-------------------------------------------
+
+  handle_type push(const value_type& val) {
+    handle_type h;
+    if (free_.empty()) {
+      h = slots_.size();
+      slots_.push_back(slot(val, heap_.size()));
+    } else {
+      h = free_.back();
+      free_.pop_back();
+      slots_[h].value = val;
+      slots_[h].pos = heap_.size();
+    }
+    heap_.push_back(h);
+    sift_up(heap_.size() - 1);
+    return h;
+  }
+
+  void pop() {
+    if (heap_.empty()) return;
+    erase(heap_.front());
+  }
+
+  void erase(handle_type h) {
+    check_handle(h, "ft::indexed_priority_queue erase() out_of_range");
+    size_type pos = slots_[h].pos;
+    handle_type last = heap_.back();
+    heap_.pop_back();
+    slots_[h].pos = npos;
+    free_.push_back(h);
+    if (last != h) {
+      place(pos, last);
+      restore(pos);
+    }
+  }
+
+  // Raises the priority of h. The new value must not compare below the old
+  // one, so the element only ever moves towards the top.
+  void decrease_key(handle_type h, const value_type& val) {
+    check_handle(h, "ft::indexed_priority_queue decrease_key() out_of_range");
+    slots_[h].value = val;
+    sift_up(slots_[h].pos);
+  }
+
+  // Changes the value of h in either direction.
+  void update(handle_type h, const value_type& val) {
+    check_handle(h, "ft::indexed_priority_queue update() out_of_range");
+    slots_[h].value = val;
+    restore(slots_[h].pos);
+  }
+
+  void clear() {
+    heap_.clear();
+    slots_.clear();
+    free_.clear();
+  }
+
+ private:
+  void check_handle(handle_type h, const char* what) const {
+    if (!contains(h)) {
+      throw std::out_of_range(what);
+    }
+  }
+
+  bool less(handle_type a, handle_type b) const {
+    return comp(slots_[a].value, slots_[b].value);
+  }
+
+  void place(size_type pos, handle_type h) {
+    heap_[pos] = h;
+    slots_[h].pos = pos;
+  }
+
+  void restore(size_type pos) {
+    if (pos != 0 && less(heap_[(pos - 1) / Arity], heap_[pos])) {
+      sift_up(pos);
+    } else {
+      sift_down(pos);
+    }
+  }
+
+  void sift_up(size_type pos) {
+    handle_type h = heap_[pos];
+    while (pos != 0) {
+      size_type parent = (pos - 1) / Arity;
+      if (!less(heap_[parent], h)) break;
+      place(pos, heap_[parent]);
+      pos = parent;
+    }
+    place(pos, h);
+  }
+
+  void sift_down(size_type pos) {
+    handle_type h = heap_[pos];
+    size_type n = heap_.size();
+    for (;;) {
+      size_type first_child = pos * Arity + 1;
+      if (first_child >= n) break;
+      size_type last_child = std::min(first_child + Arity, n);
+      size_type best = first_child;
+      for (size_type i = first_child + 1; i < last_child; i++) {
+        if (less(heap_[best], heap_[i])) best = i;
+      }
+      if (!less(h, heap_[best])) break;
+      place(pos, heap_[best]);
+      pos = best;
+    }
+    place(pos, h);
+  }
+};
+
+template <class T, class Compare, std::size_t Arity>
+const std::size_t indexed_priority_queue<T, Compare, Arity>::arity;
+
+template <class T, class Compare, std::size_t Arity>
+const typename indexed_priority_queue<T, Compare, Arity>::size_type
+    indexed_priority_queue<T, Compare, Arity>::npos;
+
+}  // namespace ft
+
+#endif /* ************************************************** PRIORITY_QUEUE_H \
+        */
\ No newline at end of file
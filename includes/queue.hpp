@@ -0,0 +1,101 @@
+#ifndef QUEUE_HPP
+#define QUEUE_HPP
+
+#include "ring_buffer.hpp"
+
+namespace ft {
+
+template <class T, class Container = ft::ring_buffer<T> >
+
+class queue {
+ public:
+  typedef Container container_type;
+  typedef typename Container::value_type value_type;
+  typedef typename Container::size_type size_type;
+  typedef typename Container::reference reference;
+  typedef typename Container::const_reference const_reference;
+
+ protected:
+  container_type c;
+
+ public:
+  explicit queue(const Container& cont = Container()) : c(cont) {}
+
+  ~queue() {}
+
+  queue& operator=(const queue& other) {
+    if (this != &other) {
+      c = other.c;
+    }
+    return *this;
+  }
+
+  // Element access--------------------------------------
+
+  reference front() { return c.front(); }
+
+  const_reference front() const { return c.front(); }
+
+  reference back() { return c.back(); }
+
+  const_reference back() const { return c.back(); }
+
+  // Capacity--------------------------------------------
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const { return c.size(); };
+
+  // Modifiers-------------------------------------------
+
+  void push(const value_type& val) { c.push_back(val); }
+
+  void pop() { c.pop_front(); };
+
+  // Comparison------------------------------------------
+
+  template <class T1, class _C1>
+  friend bool operator==(const queue<T1, _C1>& lhs, const queue<T1, _C1>& rhs);
+
+  template <class T1, class _C1>
+  friend bool operator<(const queue<T1, _C1>& lhs, const queue<T1, _C1>& rhs);
+};
+
+template <class T, class Container>
+bool operator==(const queue<T, Container>& lhs,
+                const queue<T, Container>& rhs) {
+  return lhs.c == rhs.c;
+}
+
+template <class T, class Container>
+bool operator!=(const queue<T, Container>& lhs,
+                const queue<T, Container>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, class Container>
+bool operator<(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+  return lhs.c < rhs.c;
+}
+
+template <class T, class Container>
+bool operator<=(const queue<T, Container>& lhs,
+                const queue<T, Container>& rhs) {
+  return !(lhs > rhs);
+}
+
+template <class T, class Container>
+bool operator>(const queue<T, Container>& lhs, const queue<T, Container>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, class Container>
+bool operator>=(const queue<T, Container>& lhs,
+                const queue<T, Container>& rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace ft
+
+#endif /* *********************************************************** QUEUE_H \
+        */
\ No newline at end of file
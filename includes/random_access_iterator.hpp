@@ -127,6 +127,16 @@ typename ra_iterator<Iterator1>::difference_type operator-(
     const ra_iterator<Iterator1>& lhs, const ra_iterator<Iterator2>& rhs) {
   return lhs.base() - rhs.base();
 };
+
+template <class Iterator>
+Iterator unwrap_iterator(Iterator it) {
+  return it;
+}
+
+template <class Iterator>
+Iterator unwrap_iterator(ra_iterator<Iterator> it) {
+  return it.base();
+}
 }  // namespace ft
 
 #endif /* ****************************************** RANDOM_ACCESS_ITERATOR_H \
@@ -0,0 +1,454 @@
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "enable_if.hpp"
+#include "equal.hpp"
+#include "iterator.hpp"
+#include "lexicographical_compare.hpp"
+#include "reverse_iterator.hpp"
+
+namespace ft {
+
+template <class T, class Pointer, class Reference>
+class ring_buffer_iterator
+    : public iterator<std::random_access_iterator_tag, T, std::ptrdiff_t,
+                      Pointer, Reference> {
+ public:
+  typedef T value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Pointer pointer;
+  typedef Reference reference;
+  typedef std::random_access_iterator_tag iterator_category;
+
+ private:
+  T* buffer_;
+  std::size_t mask_;
+  std::size_t index_;
+
+ public:
+  ring_buffer_iterator() : buffer_(NULL), mask_(0), index_(0) {}
+  ring_buffer_iterator(T* buffer, std::size_t mask, std::size_t index)
+      : buffer_(buffer), mask_(mask), index_(index) {}
+  template <class P, class R>
+  ring_buffer_iterator(const ring_buffer_iterator<T, P, R>& it)
+      : buffer_(it.buffer()), mask_(it.mask()), index_(it.index()) {}
+
+  reference operator*() const { return buffer_[index_ & mask_]; }
+
+  pointer operator->() const { return &(operator*()); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  ring_buffer_iterator& operator++() {
+    ++index_;
+    return *this;
+  }
+
+  ring_buffer_iterator operator++(int) {
+    ring_buffer_iterator tmp = *this;
+    ++index_;
+    return tmp;
+  }
+
+  ring_buffer_iterator& operator--() {
+    --index_;
+    return *this;
+  }
+
+  ring_buffer_iterator operator--(int) {
+    ring_buffer_iterator tmp = *this;
+    --index_;
+    return tmp;
+  }
+
+  ring_buffer_iterator& operator+=(difference_type n) {
+    index_ += n;
+    return *this;
+  }
+
+  ring_buffer_iterator& operator-=(difference_type n) {
+    index_ -= n;
+    return *this;
+  }
+
+  ring_buffer_iterator operator+(difference_type n) const {
+    return ring_buffer_iterator(buffer_, mask_, index_ + n);
+  }
+
+  ring_buffer_iterator operator-(difference_type n) const {
+    return ring_buffer_iterator(buffer_, mask_, index_ - n);
+  }
+
+  T* buffer() const { return buffer_; }
+  std::size_t mask() const { return mask_; }
+  std::size_t index() const { return index_; }
+};
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator==(const ring_buffer_iterator<T, P1, R1>& lhs,
+                const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() == rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator!=(const ring_buffer_iterator<T, P1, R1>& lhs,
+                const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() != rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator<(const ring_buffer_iterator<T, P1, R1>& lhs,
+               const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() < rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator>(const ring_buffer_iterator<T, P1, R1>& lhs,
+               const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() > rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator<=(const ring_buffer_iterator<T, P1, R1>& lhs,
+                const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() <= rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+bool operator>=(const ring_buffer_iterator<T, P1, R1>& lhs,
+                const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return lhs.index() >= rhs.index();
+}
+
+template <class T, class P1, class R1, class P2, class R2>
+std::ptrdiff_t operator-(const ring_buffer_iterator<T, P1, R1>& lhs,
+                         const ring_buffer_iterator<T, P2, R2>& rhs) {
+  return static_cast<std::ptrdiff_t>(lhs.index()) -
+         static_cast<std::ptrdiff_t>(rhs.index());
+}
+
+template <class T, class P, class R>
+ring_buffer_iterator<T, P, R> operator+(
+    std::ptrdiff_t n, const ring_buffer_iterator<T, P, R>& it) {
+  return it + n;
+}
+
+// Contiguous FIFO storage. The capacity is always a power of two so a logical
+// position maps to a slot with a mask instead of a division. Growing copies
+// the elements into a new buffer starting at slot 0.
+template <class T, class Allocator = std::allocator<T> >
+class ring_buffer {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef ring_buffer_iterator<T, pointer, reference> iterator;
+  typedef ring_buffer_iterator<T, const_pointer, const_reference>
+      const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+ protected:
+  pointer buffer_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+  allocator_type allocater_;
+
+ public:
+  ring_buffer()
+      : buffer_(NULL),
+        capacity_(0),
+        head_(0),
+        size_(0),
+        allocater_(allocator_type()){};
+
+  explicit ring_buffer(const Allocator& alloc)
+      : buffer_(NULL), capacity_(0), head_(0), size_(0), allocater_(alloc){};
+
+  explicit ring_buffer(size_type count, const T& value = T(),
+                       const Allocator& alloc = Allocator())
+      : buffer_(NULL), capacity_(0), head_(0), size_(0), allocater_(alloc) {
+    assign(count, value);
+  };
+
+  template <class InputIt>
+  ring_buffer(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+      const Allocator& alloc = Allocator())
+      : buffer_(NULL), capacity_(0), head_(0), size_(0), allocater_(alloc) {
+    assign(first, last);
+  };
+
+  ring_buffer(const ring_buffer& other)
+      : buffer_(NULL),
+        capacity_(0),
+        head_(0),
+        size_(0),
+        allocater_(other.allocater_) {
+    *this = other;
+  };
+
+  ~ring_buffer() {
+    clear();
+    if (buffer_ != NULL) {
+      allocater_.deallocate(buffer_, capacity_);
+    }
+  }
+
+  ring_buffer& operator=(const ring_buffer& other) {
+    if (this != &other) {
+      clear();
+      reserve(other.size());
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  // Iterators-------------------------------------------
+
+  iterator begin() { return iterator(buffer_, mask(), head_); }
+  const_iterator begin() const {
+    return const_iterator(buffer_, mask(), head_);
+  }
+
+  iterator end() { return iterator(buffer_, mask(), head_ + size_); }
+  const_iterator end() const {
+    return const_iterator(buffer_, mask(), head_ + size_);
+  }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  };
+
+  reverse_iterator rend() { return reverse_iterator(begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  };
+
+  // Capacity-------------------------------------------
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    return std::min<size_type>(std::numeric_limits<difference_type>::max(),
+                               allocater_.max_size());
+  }
+
+  size_type capacity() const { return capacity_; };
+
+  bool empty() const { return size_ == 0; };
+
+  void reserve(size_type n) {
+    if (capacity_ >= n) return;
+
+    if (n > max_size()) {
+      throw std::length_error("ft::ring_buffer reserve() length_error");
+    }
+    reallocate(round_up_pow2(n));
+  }
+
+  // Element access-------------------------------------
+
+  reference operator[](size_type pos) { return *slot(pos); }
+
+  const_reference operator[](size_type pos) const { return *slot(pos); }
+
+  reference at(size_type pos) {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::ring_buffer at() out_of_range");
+    }
+    return *slot(pos);
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::ring_buffer at() out_of_range");
+    }
+    return *slot(pos);
+  }
+
+  reference front() { return *slot(0); }
+
+  const_reference front() const { return *slot(0); }
+
+  reference back() { return *slot(size_ - 1); }
+
+  const_reference back() const { return *slot(size_ - 1); }
+
+  // Modifiers------------------------------------------
+
+  void assign(size_type count, const T& value) {
+    value_type tmp(value);
+    clear();
+    reserve(count);
+    for (size_type i = 0; i < count; i++) {
+      push_back(tmp);
+    }
+  }
+
+  template <class InputIt>
+  void assign(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    clear();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  void push_back(const value_type& val) {
+    if (size_ == capacity_) {
+      value_type tmp(val);
+      reallocate(calc_new_cap());
+      construct(slot(size_), tmp);
+    } else {
+      construct(slot(size_), val);
+    }
+    size_++;
+  }
+
+  void push_front(const value_type& val) {
+    if (size_ == capacity_) {
+      value_type tmp(val);
+      reallocate(calc_new_cap());
+      construct(buffer_ + ((head_ - 1) & mask()), tmp);
+    } else {
+      construct(buffer_ + ((head_ - 1) & mask()), val);
+    }
+    head_ = (head_ - 1) & mask();
+    size_++;
+  }
+
+  void pop_front() {
+    if (empty()) return;
+    destroy(slot(0));
+    head_ = (head_ + 1) & mask();
+    size_--;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    size_--;
+    destroy(slot(size_));
+  }
+
+  void clear() {
+    while (size_ != 0) {
+      pop_back();
+    }
+    head_ = 0;
+  }
+
+  void swap(ring_buffer& other) {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(allocater_, other.allocater_);
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  size_type mask() const { return capacity_ - 1; }
+
+  pointer slot(size_type pos) const {
+    return buffer_ + ((head_ + pos) & mask());
+  }
+
+  void construct(pointer ptr, const_reference value) {
+    allocater_.construct(ptr, value);
+  }
+
+  void destroy(pointer ptr) { allocater_.destroy(ptr); }
+
+  static size_type round_up_pow2(size_type n) {
+    size_type cap = 1;
+    while (cap < n) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  size_type calc_new_cap() const { return capacity_ ? capacity_ * 2 : 8; }
+
+  // Copies the elements into a buffer of new_cap slots, oldest first.
+  void reallocate(size_type new_cap) {
+    pointer new_buffer = allocater_.allocate(new_cap);
+    for (size_type i = 0; i < size_; i++) {
+      allocater_.construct(new_buffer + i, *slot(i));
+    }
+    for (size_type i = size_; i != 0;) {
+      destroy(slot(--i));
+    }
+    if (buffer_ != NULL) {
+      allocater_.deallocate(buffer_, capacity_);
+    }
+    buffer_ = new_buffer;
+    capacity_ = new_cap;
+    head_ = 0;
+  }
+};
+
+template <class T, class Alloc>
+bool operator==(const ring_buffer<T, Alloc>& lhs,
+                const ring_buffer<T, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+bool operator!=(const ring_buffer<T, Alloc>& lhs,
+                const ring_buffer<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, class Alloc>
+bool operator<(const ring_buffer<T, Alloc>& lhs,
+               const ring_buffer<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, class Alloc>
+bool operator<=(const ring_buffer<T, Alloc>& lhs,
+                const ring_buffer<T, Alloc>& rhs) {
+  return !(lhs > rhs);
+}
+
+template <class T, class Alloc>
+bool operator>(const ring_buffer<T, Alloc>& lhs,
+               const ring_buffer<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, class Alloc>
+bool operator>=(const ring_buffer<T, Alloc>& lhs,
+                const ring_buffer<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, class Alloc>
+void swap(ring_buffer<T, Alloc>& x, ring_buffer<T, Alloc>& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif /* ***************************************************** RING_BUFFER_H \
+        */
\ No newline at end of file
@@ -0,0 +1,368 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "aligned_buffer.hpp"
+#include "enable_if.hpp"
+#include "equal.hpp"
+#include "lexicographical_compare.hpp"
+#include "random_access_iterator.hpp"
+#include "reverse_iterator.hpp"
+
+namespace ft {
+
+// Vector storing its first N elements inline. The allocator is only used once
+// the size grows past N, after which it behaves like ft::vector.
+template <class T, std::size_t N, class Allocator = std::allocator<T> >
+class small_vector {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef ft::ra_iterator<pointer> iterator;
+  typedef ft::ra_iterator<const_pointer> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  static const size_type inline_capacity = N;
+
+ protected:
+  // Declared first so it exists before first_ is pointed at it.
+  aligned_buffer<T, N> buffer_;
+  pointer first_;
+  pointer last_;
+  pointer end_of_storage_;
+  allocator_type allocater_;
+
+ public:
+  small_vector()
+      : first_(buffer_.data()),
+        last_(first_),
+        end_of_storage_(first_ + N),
+        allocater_(allocator_type()){};
+
+  explicit small_vector(const Allocator& alloc)
+      : first_(buffer_.data()),
+        last_(first_),
+        end_of_storage_(first_ + N),
+        allocater_(alloc){};
+
+  explicit small_vector(size_type count, const T& value = T(),
+                        const Allocator& alloc = Allocator())
+      : first_(buffer_.data()),
+        last_(first_),
+        end_of_storage_(first_ + N),
+        allocater_(alloc) {
+    resize(count, value);
+  };
+
+  template <class InputIt>
+  small_vector(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+      const Allocator& alloc = Allocator())
+      : first_(buffer_.data()),
+        last_(first_),
+        end_of_storage_(first_ + N),
+        allocater_(alloc) {
+    insert(end(), first, last);
+  };
+
+  small_vector(const small_vector& other)
+      : first_(buffer_.data()),
+        last_(first_),
+        end_of_storage_(first_ + N),
+        allocater_(allocator_type(other.allocater_)) {
+    *this = other;
+  };
+
+  ~small_vector() {
+    clear();
+    deallocate();
+  }
+
+  small_vector& operator=(const small_vector& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  // Iterators-------------------------------------------
+
+  iterator begin() { return iterator(first_); }
+  const_iterator begin() const { return const_iterator(first_); }
+
+  iterator end() { return iterator(last_); }
+  const_iterator end() const { return const_iterator(last_); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  };
+
+  reverse_iterator rend() { return reverse_iterator(begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  };
+
+  // Capacity-------------------------------------------
+
+  size_type size() const { return last_ - first_; }
+
+  size_type max_size() const {
+    return std::min<size_type>(std::numeric_limits<difference_type>::max(),
+                               allocater_.max_size());
+  }
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n < size()) {
+      erase(begin() + n, end());
+    } else if (n > size()) {
+      insert(end(), n - size(), val);
+    }
+  };
+
+  size_type capacity() const { return end_of_storage_ - first_; };
+
+  bool empty() const { return first_ == last_; };
+
+  bool is_inline() const { return first_ == buffer_.data(); }
+
+  void reserve(size_type n) {
+    if (capacity() >= n) return;
+
+    if (n > max_size()) {
+      throw std::length_error("ft::small_vector reserve() length_error");
+    }
+
+    pointer old_first = first_;
+    pointer old_last = last_;
+    size_type old_cap = capacity();
+    bool was_inline = is_inline();
+
+    first_ = allocate(n);
+    last_ = first_;
+    end_of_storage_ = first_ + n;
+
+    for (pointer p = old_first; p != old_last; ++p, ++last_) {
+      construct(last_, *p);
+    }
+    for (pointer p = old_last; p != old_first;) {
+      destroy(--p);
+    }
+    if (!was_inline) {
+      allocater_.deallocate(old_first, old_cap);
+    }
+  }
+
+  // Element access-------------------------------------
+
+  reference operator[](size_type pos) { return first_[pos]; }
+
+  const_reference operator[](size_type pos) const { return first_[pos]; }
+
+  reference at(size_type pos) {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::small_vector at() out_of_range");
+    }
+    return first_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::small_vector at() out_of_range");
+    }
+    return first_[pos];
+  }
+
+  reference front() { return *first_; }
+
+  const_reference front() const { return *first_; }
+
+  reference back() { return *(last_ - 1); }
+
+  const_reference back() const { return *(last_ - 1); }
+
+  // Modifiers------------------------------------------
+
+  void assign(size_type count, const T& value) {
+    value_type tmp(value);
+    clear();
+    insert(end(), count, tmp);
+  }
+
+  template <class InputIt>
+  void assign(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void push_back(const value_type& val) {
+    if (last_ == end_of_storage_) {
+      value_type tmp(val);
+      reserve(calc_new_cap(size() + 1));
+      construct(last_, tmp);
+    } else {
+      construct(last_, val);
+    }
+    last_++;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    last_--;
+    destroy(last_);
+  }
+
+  iterator insert(iterator pos, const value_type& value) {
+    difference_type offset = pos - begin();
+    insert(pos, 1, value);
+    return begin() + offset;
+  }
+
+  void insert(iterator pos, size_type count, const value_type& value) {
+    value_type tmp(value);
+    pos = insert_helper(pos, count);
+    std::fill_n(pos, count, tmp);
+  }
+
+  template <class InputIt>
+  void insert(
+      iterator pos,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+      InputIt last) {
+    pos = insert_helper(pos, std::distance(first, last));
+    std::copy(first, last, pos);
+  }
+
+  iterator erase(iterator position) { return erase(position, position + 1); };
+
+  iterator erase(iterator first, iterator last) {
+    iterator new_end = std::copy(last, end(), first);
+    destroy_until(new_end.base());
+    return first;
+  };
+
+  void clear() { destroy_until(first_); }
+
+  void swap(small_vector& other) {
+    if (is_inline() || other.is_inline()) {
+      small_vector tmp(*this);
+      *this = other;
+      other = tmp;
+      return;
+    }
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(end_of_storage_, other.end_of_storage_);
+    std::swap(allocater_, other.allocater_);
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  pointer allocate(size_type n) { return allocater_.allocate(n); }
+
+  void deallocate() {
+    if (!is_inline()) {
+      allocater_.deallocate(first_, capacity());
+    }
+  }
+
+  void construct(pointer ptr, const_reference value) {
+    allocater_.construct(ptr, value);
+  }
+
+  void destroy(pointer ptr) { allocater_.destroy(ptr); }
+
+  void destroy_until(pointer new_last) {
+    while (last_ != new_last) {
+      destroy(--last_);
+    }
+  }
+
+  size_type calc_new_cap(size_type new_cap) {
+    size_type current_cap = capacity();
+    if (current_cap >= new_cap) return current_cap;
+    return std::max(current_cap * 2, new_cap);
+  }
+
+  iterator insert_helper(iterator pos, size_type count) {
+    if (capacity() < size() + count) {
+      difference_type offset_size = pos - begin();
+      reserve(calc_new_cap(size() + count));
+      pos = begin() + offset_size;
+    }
+
+    std::uninitialized_fill_n(end(), count, T());
+    std::copy_backward(pos, end(), iterator(last_ + count));
+    last_ += count;
+    return pos;
+  }
+};
+
+template <class T, std::size_t N, class Alloc>
+const typename small_vector<T, N, Alloc>::size_type
+    small_vector<T, N, Alloc>::inline_capacity;
+
+template <class T, std::size_t N, class Alloc>
+bool operator==(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator!=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator<(const small_vector<T, N, Alloc>& lhs,
+               const small_vector<T, N, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator<=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs > rhs);
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator>(const small_vector<T, N, Alloc>& lhs,
+               const small_vector<T, N, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, std::size_t N, class Alloc>
+bool operator>=(const small_vector<T, N, Alloc>& lhs,
+                const small_vector<T, N, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, std::size_t N, class Alloc>
+void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif /* **************************************************** SMALL_VECTOR_H \
+        */
\ No newline at end of file
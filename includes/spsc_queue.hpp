@@ -0,0 +1,185 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "atomic.hpp"
+
+namespace ft {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. The producer only writes tail_ and the consumer only writes head_;
+// each side keeps a cached copy of the other index so the shared cache line
+// is only read when the queue looks full or empty.
+template <class T, class Allocator = std::allocator<T> >
+class spsc_queue {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+ protected:
+  pointer buffer_;
+  size_type mask_;
+  allocator_type allocater_;
+  char pad0_[cache_line_size];
+
+  // Consumer side.
+  size_type head_;
+  size_type cached_tail_;
+  char pad1_[cache_line_size - 2 * sizeof(size_type)];
+
+  // Producer side.
+  size_type tail_;
+  size_type cached_head_;
+  char pad2_[cache_line_size - 2 * sizeof(size_type)];
+
+ public:
+  explicit spsc_queue(size_type capacity,
+                      const Allocator& alloc = Allocator())
+      : buffer_(NULL),
+        mask_(0),
+        allocater_(alloc),
+        head_(0),
+        cached_tail_(0),
+        tail_(0),
+        cached_head_(0) {
+    if (capacity > max_size()) {
+      throw std::length_error("ft::spsc_queue spsc_queue() length_error");
+    }
+    size_type cap = 1;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    buffer_ = allocater_.allocate(cap);
+    mask_ = cap - 1;
+  }
+
+  ~spsc_queue() {
+    for (size_type i = head_; i != tail_; i++) {
+      allocater_.destroy(buffer_ + (i & mask_));
+    }
+    allocater_.deallocate(buffer_, capacity());
+  }
+
+  // Capacity-------------------------------------------
+
+  size_type capacity() const { return mask_ + 1; }
+
+  size_type max_size() const {
+    return std::min<size_type>(std::numeric_limits<difference_type>::max(),
+                               allocater_.max_size());
+  }
+
+  // Only a snapshot when the other side is running.
+  size_type size() const {
+    size_type head = atomic_load_acquire(&head_);
+    return atomic_load_acquire(&tail_) - head;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // Producer-------------------------------------------
+
+  bool try_push(const value_type& val) {
+    size_type tail = tail_;
+    if (tail - cached_head_ == capacity()) {
+      cached_head_ = atomic_load_acquire(&head_);
+      if (tail - cached_head_ == capacity()) return false;
+    }
+    allocater_.construct(buffer_ + (tail & mask_), val);
+    atomic_store_release(&tail_, tail + 1);
+    return true;
+  }
+
+  void push(const value_type& val) {
+    backoff wait;
+    while (!try_push(val)) {
+      wait.pause();
+    }
+  }
+
+  // Pushes up to count elements from first and publishes them with a single
+  // release store. Returns the number of elements pushed.
+  template <class InputIt>
+  size_type try_push_n(InputIt first, size_type count) {
+    size_type tail = tail_;
+    if (capacity() - (tail - cached_head_) < count) {
+      cached_head_ = atomic_load_acquire(&head_);
+    }
+    size_type free_slots = capacity() - (tail - cached_head_);
+    if (count > free_slots) count = free_slots;
+
+    for (size_type i = 0; i < count; i++, ++first) {
+      allocater_.construct(buffer_ + ((tail + i) & mask_), *first);
+    }
+    if (count != 0) {
+      atomic_store_release(&tail_, tail + count);
+    }
+    return count;
+  }
+
+  // Consumer-------------------------------------------
+
+  bool try_pop(value_type& out) {
+    size_type head = head_;
+    if (head == cached_tail_) {
+      cached_tail_ = atomic_load_acquire(&tail_);
+      if (head == cached_tail_) return false;
+    }
+    pointer slot = buffer_ + (head & mask_);
+    out = *slot;
+    allocater_.destroy(slot);
+    atomic_store_release(&head_, head + 1);
+    return true;
+  }
+
+  void pop(value_type& out) {
+    backoff wait;
+    while (!try_pop(out)) {
+      wait.pause();
+    }
+  }
+
+  // Pops up to max_count elements into out and releases their slots with a
+  // single store. Returns the number of elements popped.
+  template <class OutputIt>
+  size_type try_pop_n(OutputIt out, size_type max_count) {
+    size_type head = head_;
+    if (cached_tail_ - head < max_count) {
+      cached_tail_ = atomic_load_acquire(&tail_);
+    }
+    size_type count = cached_tail_ - head;
+    if (count > max_count) count = max_count;
+
+    for (size_type i = 0; i < count; i++, ++out) {
+      pointer slot = buffer_ + ((head + i) & mask_);
+      *out = *slot;
+      allocater_.destroy(slot);
+    }
+    if (count != 0) {
+      atomic_store_release(&head_, head + count);
+    }
+    return count;
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  spsc_queue(const spsc_queue&);
+  spsc_queue& operator=(const spsc_queue&);
+};
+
+}  // namespace ft
+
+#endif /* ****************************************************** SPSC_QUEUE_H \
+        */
\ No newline at end of file
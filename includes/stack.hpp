@@ -1,10 +1,33 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include "enable_if.hpp"
 #include "vector.hpp"
 
 namespace ft {
 
+// True when Container has a member void reserve(size_type).
+template <class Container>
+struct has_reserve {
+ private:
+  typedef char yes;
+  typedef char (&no)[2];
+
+  template <class U, void (U::*)(typename U::size_type)>
+  struct check;
+
+  template <class U>
+  static yes test(check<U, &U::reserve>*);
+  template <class U>
+  static no test(...);
+
+ public:
+  static const bool value = sizeof(test<Container>(0)) == sizeof(yes);
+};
+
+template <class Container>
+const bool has_reserve<Container>::value;
+
 template <class T, class Container = ft::vector<T> >
 
 class stack {
@@ -12,6 +35,8 @@ class stack {
   typedef Container container_type;
   typedef typename Container::value_type value_type;
   typedef typename Container::size_type size_type;
+  typedef typename Container::reference reference;
+  typedef typename Container::const_reference const_reference;
 
  protected:
   container_type c;
@@ -30,9 +55,9 @@ class stack {
 
   // Element access--------------------------------------
 
-  value_type& top() { return c.back(); }
+  reference top() { return c.back(); }
 
-  const value_type& top() const { return c.back(); }
+  const_reference top() const { return c.back(); }
 
   // Capacity--------------------------------------------
 
@@ -46,6 +71,45 @@ class stack {
 
   void pop() { c.pop_back(); };
 
+  // Constructs the element from up to three arguments. Without variadic
+  // templates it is still copied into the container once.
+  void emplace() { c.push_back(value_type()); }
+
+  template <class A1>
+  void emplace(const A1& a1) {
+    c.push_back(value_type(a1));
+  }
+
+  template <class A1, class A2>
+  void emplace(const A1& a1, const A2& a2) {
+    c.push_back(value_type(a1, a2));
+  }
+
+  template <class A1, class A2, class A3>
+  void emplace(const A1& a1, const A2& a2, const A3& a3) {
+    c.push_back(value_type(a1, a2, a3));
+  }
+
+  // Pushes [first, last) with a single range insert, so the container checks
+  // its capacity once. The last element of the range ends up on top.
+  template <class InputIt>
+  void push_range(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    c.insert(c.end(), first, last);
+  }
+
+  // Removes the top n elements (all of them if n > size()).
+  void pop_n(size_type n) {
+    if (n > size()) n = size();
+    c.erase(c.end() - n, c.end());
+  }
+
+  // Forwards to Container::reserve when it exists; no-op otherwise.
+  void reserve(size_type n) {
+    reserve(n, integral_constant<bool, has_reserve<Container>::value>());
+  }
+
   // Comparison------------------------------------------
 
   template <class T1, class _C1>
@@ -53,6 +117,11 @@ class stack {
 
   template <class T1, class _C1>
   friend bool operator<(const stack<T1, _C1>& lhs, const stack<T1, _C1>& rhs);
+
+ private:
+  void reserve(size_type n, true_type) { c.reserve(n); }
+
+  void reserve(size_type, false_type) {}
 };
 
 template <class T, class Container>
@@ -0,0 +1,283 @@
+#ifndef STATIC_VECTOR_HPP
+#define STATIC_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "aligned_buffer.hpp"
+#include "enable_if.hpp"
+#include "equal.hpp"
+#include "lexicographical_compare.hpp"
+#include "random_access_iterator.hpp"
+#include "reverse_iterator.hpp"
+
+namespace ft {
+
+// Vector with a fixed capacity of N elements stored inline. It never
+// allocates; growing past N throws std::length_error.
+template <class T, std::size_t N>
+class static_vector {
+ public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef ft::ra_iterator<pointer> iterator;
+  typedef ft::ra_iterator<const_pointer> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+ protected:
+  aligned_buffer<T, N> buffer_;
+  size_type size_;
+
+ public:
+  static_vector() : size_(0){};
+
+  explicit static_vector(size_type count, const T& value = T()) : size_(0) {
+    resize(count, value);
+  };
+
+  template <class InputIt>
+  static_vector(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last)
+      : size_(0) {
+    insert(end(), first, last);
+  };
+
+  static_vector(const static_vector& other) : size_(0) { *this = other; };
+
+  ~static_vector() { clear(); }
+
+  static_vector& operator=(const static_vector& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  // Iterators-------------------------------------------
+
+  iterator begin() { return iterator(first()); }
+  const_iterator begin() const { return const_iterator(first()); }
+
+  iterator end() { return iterator(last()); }
+  const_iterator end() const { return const_iterator(last()); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  };
+
+  reverse_iterator rend() { return reverse_iterator(begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  };
+
+  // Capacity-------------------------------------------
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const { return N; }
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n < size()) {
+      erase(begin() + n, end());
+    } else if (n > size()) {
+      insert(end(), n - size(), val);
+    }
+  };
+
+  size_type capacity() const { return N; };
+
+  bool empty() const { return size_ == 0; };
+
+  void reserve(size_type n) {
+    if (n > N) {
+      throw std::length_error("ft::static_vector reserve() length_error");
+    }
+  }
+
+  // Element access-------------------------------------
+
+  reference operator[](size_type pos) { return first()[pos]; }
+
+  const_reference operator[](size_type pos) const { return first()[pos]; }
+
+  reference at(size_type pos) {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::static_vector at() out_of_range");
+    }
+    return first()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::static_vector at() out_of_range");
+    }
+    return first()[pos];
+  }
+
+  reference front() { return *first(); }
+
+  const_reference front() const { return *first(); }
+
+  reference back() { return *(last() - 1); }
+
+  const_reference back() const { return *(last() - 1); }
+
+  // Modifiers------------------------------------------
+
+  void assign(size_type count, const T& value) {
+    value_type tmp(value);
+    clear();
+    insert(end(), count, tmp);
+  }
+
+  template <class InputIt>
+  void assign(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void push_back(const value_type& val) {
+    check_capacity(1, "ft::static_vector push_back() length_error");
+    construct(last(), val);
+    size_++;
+  }
+
+  void pop_back() {
+    if (empty()) return;
+    size_--;
+    destroy(last());
+  }
+
+  iterator insert(iterator pos, const value_type& value) {
+    insert(pos, 1, value);
+    return pos;
+  }
+
+  void insert(iterator pos, size_type count, const value_type& value) {
+    value_type tmp(value);
+    pos = insert_helper(pos, count);
+    std::fill_n(pos, count, tmp);
+  }
+
+  template <class InputIt>
+  void insert(
+      iterator pos,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+      InputIt last) {
+    pos = insert_helper(pos, std::distance(first, last));
+    std::copy(first, last, pos);
+  }
+
+  iterator erase(iterator position) { return erase(position, position + 1); };
+
+  iterator erase(iterator first, iterator last) {
+    iterator new_end = std::copy(last, end(), first);
+    destroy_until(new_end.base());
+    return first;
+  };
+
+  void clear() { destroy_until(first()); }
+
+  void swap(static_vector& other) {
+    static_vector tmp(*this);
+    *this = other;
+    other = tmp;
+  }
+
+ private:
+  pointer first() { return buffer_.data(); }
+  const_pointer first() const { return buffer_.data(); }
+
+  pointer last() { return first() + size_; }
+  const_pointer last() const { return first() + size_; }
+
+  void construct(pointer ptr, const_reference value) {
+    new (static_cast<void*>(ptr)) value_type(value);
+  }
+
+  void destroy(pointer ptr) { ptr->~value_type(); }
+
+  void destroy_until(pointer new_last) {
+    while (last() != new_last) {
+      size_--;
+      destroy(last());
+    }
+  }
+
+  void check_capacity(size_type count, const char* what) const {
+    if (count > N - size_) {
+      throw std::length_error(what);
+    }
+  }
+
+  iterator insert_helper(iterator pos, size_type count) {
+    check_capacity(count, "ft::static_vector insert() length_error");
+
+    std::uninitialized_fill_n(end(), count, T());
+    std::copy_backward(pos, end(), iterator(last() + count));
+    size_ += count;
+    return pos;
+  }
+};
+
+template <class T, std::size_t N>
+bool operator==(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+  return lhs.size() == rhs.size() &&
+         ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, std::size_t N>
+bool operator!=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, std::size_t N>
+bool operator<(const static_vector<T, N>& lhs,
+               const static_vector<T, N>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, std::size_t N>
+bool operator<=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+  return !(lhs > rhs);
+}
+
+template <class T, std::size_t N>
+bool operator>(const static_vector<T, N>& lhs,
+               const static_vector<T, N>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, std::size_t N>
+bool operator>=(const static_vector<T, N>& lhs,
+                const static_vector<T, N>& rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, std::size_t N>
+void swap(static_vector<T, N>& x, static_vector<T, N>& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif /* *************************************************** STATIC_VECTOR_H \
+        */
\ No newline at end of file
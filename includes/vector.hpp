@@ -3,12 +3,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <stdexcept>
 
 #include "enable_if.hpp"
 #include "equal.hpp"
+#include "iterator_traits.hpp"
 #include "lexicographical_compare.hpp"
 #include "random_access_iterator.hpp"
 #include "reverse_iterator.hpp"
@@ -36,20 +39,30 @@ class vector {
   pointer last_;
   pointer end_of_storage_;
   allocator_type allocater_;
+  size_type shrink_factor_;
 
  public:
   vector()
       : first_(NULL),
         last_(NULL),
         end_of_storage_(NULL),
-        allocater_(allocator_type()){};
+        allocater_(allocator_type()),
+        shrink_factor_(0){};
 
   explicit vector(const Allocator& alloc)
-      : first_(NULL), last_(NULL), end_of_storage_(NULL), allocater_(alloc){};
+      : first_(NULL),
+        last_(NULL),
+        end_of_storage_(NULL),
+        allocater_(alloc),
+        shrink_factor_(0){};
 
   explicit vector(size_type count, const T& value = T(),
                   const Allocator& alloc = Allocator())
-      : first_(NULL), last_(NULL), end_of_storage_(NULL), allocater_(alloc) {
+      : first_(NULL),
+        last_(NULL),
+        end_of_storage_(NULL),
+        allocater_(alloc),
+        shrink_factor_(0) {
     resize(count, value);
   };
 
@@ -57,7 +70,11 @@ class vector {
   vector(InputIt first,
          typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
          const Allocator& alloc = Allocator())
-      : first_(NULL), last_(NULL), end_of_storage_(NULL), allocater_(alloc) {
+      : first_(NULL),
+        last_(NULL),
+        end_of_storage_(NULL),
+        allocater_(alloc),
+        shrink_factor_(0) {
     insert(begin(), first, last);
   };
 
@@ -65,18 +82,23 @@ class vector {
       : first_(NULL),
         last_(NULL),
         end_of_storage_(NULL),
-        allocater_(allocator_type(other.allocater_)) {
+        allocater_(allocator_type(other.allocater_)),
+        shrink_factor_(other.shrink_factor_) {
     *this = other;
   };
 
   ~vector() {
-    clear();
+    destroy_until(first_);
     deallocate();
   }
 
+  // Copies the shrink policy along with the elements, as the copy
+  // constructor and swap() do.
   vector& operator=(const vector& other) {
     if (this != &other) {
       assign(other.begin(), other.end());
+      shrink_factor_ = other.shrink_factor_;
+      shrink_if_sparse();
     }
     return *this;
   }
@@ -112,10 +134,22 @@ class vector {
     if (n < size()) {
       erase(begin() + n, end());
     } else if (n > size()) {
-      insert(end(), n - size(), val);
+      reserve(calc_new_cap(n));
+      for (pointer new_last = first_ + n; last_ != new_last; last_++) {
+        construct(last_, val);
+      }
     }
   };
 
+  void resize_default_init(size_type n) {
+    if (n < size()) {
+      erase(begin() + n, end());
+    } else if (n > size()) {
+      reserve(calc_new_cap(n));
+      default_init_until(first_ + n, is_scalar<value_type>());
+    }
+  }
+
   size_type capacity() const {
     return std::distance(begin(), const_iterator(end_of_storage_));
   };
@@ -129,28 +163,36 @@ class vector {
       throw std::length_error("ft::vector reserve() length_error");
     }
 
-    iterator old_begin = begin();
-    iterator old_end = end();
-    reverse_iterator old_rbegin = rbegin();
-    reverse_iterator old_rend = rend();
-    pointer old_first = first_;
-    size_type old_cap = capacity();
-    size_type old_size = size();
-
-    first_ = allocate(n);
-    last_ = first_ + old_size;
-    end_of_storage_ = first_ + n;
+    reallocate(n);
+  }
 
-    for (size_t i = 0; (old_begin + i) != old_end; i++) {
-      construct(first_ + i, *(old_begin + i));
+  void shrink_to_fit() {
+    if (capacity() > size()) {
+      reallocate(size());
     }
+  }
 
-    for (reverse_iterator rit = old_rbegin; rit != old_rend; rit++) {
-      destroy(&(*rit));
+  // When factor is non-zero, erase/pop_back/clear release memory once size()
+  // drops below capacity() / factor. The new capacity is size() * factor / 2,
+  // so a vector oscillating around one size does not reallocate every time.
+  // factor is 0 (never shrink) or at least 3: with 1 or 2 the new capacity
+  // leaves no room to grow and every pop/push pair would reallocate.
+  // With the policy on, these calls no longer keep the usual guarantees:
+  // a shrink moves the elements, so it invalidates every iterator, pointer
+  // and reference, also those before the erase point; and erase/pop_back
+  // may throw std::bad_alloc or whatever T's copy constructor throws, like
+  // reserve(). clear() only frees the buffer and does not throw.
+  void set_shrink_factor(size_type factor) {
+    if (factor == 1 || factor == 2) {
+      throw std::invalid_argument(
+          "ft::vector set_shrink_factor() invalid_argument");
     }
-    allocater_.deallocate(old_first, old_cap);
+    shrink_factor_ = factor;
+    shrink_if_sparse();
   }
 
+  size_type shrink_factor() const { return shrink_factor_; }
+
   // Element access-------------------------------------
 
   reference operator[](size_type pos) { return first_[pos]; }
@@ -190,17 +232,18 @@ class vector {
   // Modifiers------------------------------------------
 
   void assign(size_type count, const T& value) {
-    size_type old_size = size();
-    reverse_iterator old_rbegin = rbegin();
+    value_type tmp(value);
 
-    reserve(calc_new_cap(count));
-    last_ = first_;
-    for (size_type i = 0; i < count; i++, last_++) {
-      construct(first_ + i, value);
+    if (count > capacity()) {
+      clear();
+      reserve(calc_new_cap(count));
     }
-
-    if (old_size > count) {
-      destroy_until(old_rbegin + (old_size - count));
+    std::fill_n(first_, std::min(count, size()), tmp);
+    if (count < size()) {
+      destroy_until(first_ + count);
+    }
+    for (pointer new_last = first_ + count; last_ != new_last; last_++) {
+      construct(last_, tmp);
     }
   }
 
@@ -208,19 +251,8 @@ class vector {
   void assign(
       InputIt first,
       typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
-    size_type old_size = size();
-    reverse_iterator old_rbegin = rbegin();
-    size_type new_size = std::distance(first, last);
-
-    reserve(calc_new_cap(new_size));
-    last_ = first_;
-    for (InputIt it = first; it != last; last_++, it++) {
-      construct(last_, *it);
-    }
-
-    if (old_size > new_size) {
-      destroy_until(old_rbegin + (old_size - new_size));
-    }
+    assign_range(first, last,
+                 typename iterator_traits<InputIt>::iterator_category());
   }
 
   void push_back(const value_type& val) {
@@ -231,10 +263,27 @@ class vector {
     last_++;
   }
 
+  void append(const_pointer src, size_type count) {
+    if (capacity() < size() + count) {
+      bool is_self = first_ <= src && src < last_;
+      difference_type offset = src - first_;
+      reserve(calc_new_cap(size() + count));
+      if (is_self) src = first_ + offset;
+    }
+    construct_at_end(src, src + count);
+  }
+
+  pointer append_uninitialized(size_type count) {
+    size_type old_size = size();
+    resize_default_init(old_size + count);
+    return first_ + old_size;
+  }
+
   void pop_back() {
     if (size() == 0) return;
     last_--;
     destroy(last_);
+    shrink_if_sparse();
   }
 
   iterator insert(iterator pos, const value_type& value) {
@@ -252,30 +301,38 @@ class vector {
       iterator pos,
       typename enable_if<!is_integral<InputIt>::value, InputIt>::type first,
       InputIt last) {
-    pos = insert_helper(pos, std::distance(first, last));
-    std::copy(first, last, pos);
+    insert_range(pos, first, last,
+                 typename iterator_traits<InputIt>::iterator_category());
   }
 
   iterator erase(iterator position) {
-    std::copy(position + 1, end(), position);
-    destroy_until(rbegin() + 1);
-    return position;
+    difference_type offset = std::distance(begin(), position);
+    pointer new_last =
+        copy_to(position.base() + 1, last_, position.base());
+    destroy_until(new_last);
+    shrink_if_sparse();
+    return begin() + offset;
   };
 
   iterator erase(iterator first, iterator last) {
-    difference_type len = std::distance(first, last);
-    std::copy(last, end(), first);
-    destroy_until(rbegin() + len);
-    return first;
+    difference_type offset = std::distance(begin(), first);
+    pointer new_last = copy_to(last.base(), last_, first.base());
+    destroy_until(new_last);
+    shrink_if_sparse();
+    return begin() + offset;
   };
 
-  void clear() { destroy_until(rend()); }
+  void clear() {
+    destroy_until(first_);
+    shrink_if_sparse();
+  }
 
   void swap(vector& other) {
     std::swap(first_, other.first_);
     std::swap(last_, other.last_);
     std::swap(end_of_storage_, other.end_of_storage_);
     std::swap(allocater_, other.allocater_);
+    std::swap(shrink_factor_, other.shrink_factor_);
   }
 
   allocator_type get_allocator() const { return allocater_; }
@@ -293,12 +350,146 @@ class vector {
 
   void destroy(pointer ptr) { allocater_.destroy(ptr); }
 
-  void destroy_until(reverse_iterator rend) {
-    for (reverse_iterator riter = rbegin(); riter != rend; ++riter, --last_) {
-      destroy(&(*riter));
+  void destroy_until(pointer new_last) {
+    destroy_range(new_last, last_, is_trivially_destructible<value_type>());
+    last_ = new_last;
+  }
+
+  void destroy_range(pointer, pointer, true_type) {}
+
+  void destroy_range(pointer first, pointer last, false_type) {
+    while (last != first) {
+      destroy(--last);
+    }
+  }
+
+  void reallocate(size_type n) {
+    pointer old_first = first_;
+    pointer old_last = last_;
+    size_type old_cap = capacity();
+
+    first_ = n ? allocate(n) : NULL;
+    last_ = first_;
+    end_of_storage_ = first_ + n;
+
+    construct_at_end(old_first, old_last);
+    destroy_range(old_first, old_last,
+                  is_trivially_destructible<value_type>());
+    allocater_.deallocate(old_first, old_cap);
+  }
+
+  void shrink_if_sparse() {
+    if (shrink_factor_ == 0 || size() * shrink_factor_ >= capacity()) return;
+    reallocate(std::max(size(), size() * shrink_factor_ / 2));
+  }
+
+  void default_init_until(pointer new_last, true_type) { last_ = new_last; }
+
+  void default_init_until(pointer new_last, false_type) {
+    for (; last_ != new_last; last_++) {
+      construct(last_, value_type());
+    }
+  }
+
+  template <class InputIt>
+  void assign_range(InputIt first, InputIt last, std::input_iterator_tag) {
+    clear();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+
+  template <class ForwardIt>
+  void assign_range(ForwardIt first, ForwardIt last,
+                    std::forward_iterator_tag) {
+    size_type new_size = std::distance(first, last);
+
+    if (new_size > capacity()) {
+      clear();
+      reserve(calc_new_cap(new_size));
+      construct_at_end(unwrap_iterator(first), unwrap_iterator(last));
+    } else if (new_size <= size()) {
+      pointer new_last =
+          copy_to(unwrap_iterator(first), unwrap_iterator(last), first_);
+      destroy_until(new_last);
+    } else {
+      ForwardIt mid = first;
+      std::advance(mid, size());
+      copy_to(unwrap_iterator(first), unwrap_iterator(mid), first_);
+      construct_at_end(unwrap_iterator(mid), unwrap_iterator(last));
+    }
+  }
+
+  template <class InputIt>
+  void insert_range(iterator pos, InputIt first, InputIt last,
+                    std::input_iterator_tag) {
+    difference_type offset = std::distance(begin(), pos);
+    size_type old_size = size();
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+    std::rotate(begin() + offset, begin() + old_size, end());
+  }
+
+  template <class ForwardIt>
+  void insert_range(iterator pos, ForwardIt first, ForwardIt last,
+                    std::forward_iterator_tag) {
+    pos = insert_helper(pos, std::distance(first, last));
+    copy_to(unwrap_iterator(first), unwrap_iterator(last), pos.base());
+  }
+
+  template <class It>
+  pointer copy_to(It first, It last, pointer dst) {
+    return std::copy(first, last, dst);
+  }
+
+  pointer copy_to(pointer first, pointer last, pointer dst) {
+    return copy_to(const_pointer(first), const_pointer(last), dst);
+  }
+
+  pointer copy_to(const_pointer first, const_pointer last, pointer dst) {
+    return copy_contiguous(first, last, dst, is_scalar<value_type>());
+  }
+
+  pointer copy_contiguous(const_pointer first, const_pointer last,
+                          pointer dst, true_type) {
+    if (first == last) return dst;
+    std::memmove(dst, first, (last - first) * sizeof(value_type));
+    return dst + (last - first);
+  }
+
+  pointer copy_contiguous(const_pointer first, const_pointer last,
+                          pointer dst, false_type) {
+    return std::copy(first, last, dst);
+  }
+
+  template <class It>
+  void construct_at_end(It first, It last) {
+    for (; first != last; ++first, ++last_) {
+      construct(last_, *first);
     }
   }
 
+  void construct_at_end(pointer first, pointer last) {
+    construct_at_end(const_pointer(first), const_pointer(last));
+  }
+
+  void construct_at_end(const_pointer first, const_pointer last) {
+    construct_contiguous(first, last, is_scalar<value_type>());
+  }
+
+  void construct_contiguous(const_pointer first, const_pointer last,
+                            true_type) {
+    if (first == last) return;
+    std::memcpy(last_, first, (last - first) * sizeof(value_type));
+    last_ += last - first;
+  }
+
+  void construct_contiguous(const_pointer first, const_pointer last,
+                            false_type) {
+    construct_at_end<const_pointer>(first, last);
+  }
+
   size_type calc_new_cap(size_type new_cap) {
     size_type current_cap = capacity();
     if (current_cap >= new_cap) return current_cap;
@@ -358,5 +549,7 @@ void swap(vector<T, Alloc>& x, vector<T, Alloc>& y) {
 
 }  // namespace ft
 
+#include "vector_bool.hpp"
+
 #endif /* ********************************************************** VECTOR_H \
         */
\ No newline at end of file
@@ -0,0 +1,714 @@
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "enable_if.hpp"
+#include "iterator.hpp"
+#include "iterator_traits.hpp"
+#include "lexicographical_compare.hpp"
+#include "reverse_iterator.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+typedef unsigned long bit_word_type;
+
+static const std::size_t bits_per_word = sizeof(bit_word_type) * CHAR_BIT;
+
+class bit_reference {
+ private:
+  bit_word_type* word_;
+  bit_word_type mask_;
+
+ public:
+  bit_reference() : word_(NULL), mask_(0) {}
+  bit_reference(bit_word_type* word, bit_word_type mask)
+      : word_(word), mask_(mask) {}
+
+  operator bool() const { return (*word_ & mask_) != 0; }
+
+  bool operator~() const { return !(*word_ & mask_); }
+
+  bit_reference& operator=(bool x) {
+    if (x) {
+      *word_ |= mask_;
+    } else {
+      *word_ &= ~mask_;
+    }
+    return *this;
+  }
+
+  bit_reference& operator=(const bit_reference& x) {
+    return *this = bool(x);
+  }
+
+  bool operator==(const bit_reference& x) const {
+    return bool(*this) == bool(x);
+  }
+
+  bool operator<(const bit_reference& x) const {
+    return !bool(*this) && bool(x);
+  }
+
+  void flip() { *word_ ^= mask_; }
+};
+
+inline void swap(bit_reference x, bit_reference y) {
+  bool tmp = x;
+  x = y;
+  y = tmp;
+}
+
+class bit_iterator_base
+    : public iterator<std::random_access_iterator_tag, bool> {
+ public:
+  bit_word_type* word_;
+  unsigned int offset_;
+
+  bit_iterator_base(bit_word_type* word, unsigned int offset)
+      : word_(word), offset_(offset) {}
+
+  void bump_up() {
+    if (offset_++ == bits_per_word - 1) {
+      offset_ = 0;
+      ++word_;
+    }
+  }
+
+  void bump_down() {
+    if (offset_-- == 0) {
+      offset_ = bits_per_word - 1;
+      --word_;
+    }
+  }
+
+  void incr(std::ptrdiff_t n) {
+    std::ptrdiff_t bits = static_cast<std::ptrdiff_t>(bits_per_word);
+    std::ptrdiff_t total = n + offset_;
+    word_ += total / bits;
+    total %= bits;
+    if (total < 0) {
+      total += bits;
+      --word_;
+    }
+    offset_ = static_cast<unsigned int>(total);
+  }
+};
+
+inline bool operator==(const bit_iterator_base& lhs,
+                       const bit_iterator_base& rhs) {
+  return lhs.word_ == rhs.word_ && lhs.offset_ == rhs.offset_;
+}
+
+inline bool operator!=(const bit_iterator_base& lhs,
+                       const bit_iterator_base& rhs) {
+  return !(lhs == rhs);
+}
+
+inline bool operator<(const bit_iterator_base& lhs,
+                      const bit_iterator_base& rhs) {
+  return lhs.word_ < rhs.word_ ||
+         (lhs.word_ == rhs.word_ && lhs.offset_ < rhs.offset_);
+}
+
+inline bool operator>(const bit_iterator_base& lhs,
+                      const bit_iterator_base& rhs) {
+  return rhs < lhs;
+}
+
+inline bool operator<=(const bit_iterator_base& lhs,
+                       const bit_iterator_base& rhs) {
+  return !(rhs < lhs);
+}
+
+inline bool operator>=(const bit_iterator_base& lhs,
+                       const bit_iterator_base& rhs) {
+  return !(lhs < rhs);
+}
+
+inline std::ptrdiff_t operator-(const bit_iterator_base& lhs,
+                                const bit_iterator_base& rhs) {
+  std::ptrdiff_t bits = static_cast<std::ptrdiff_t>(bits_per_word);
+  return bits * (lhs.word_ - rhs.word_) + lhs.offset_ - rhs.offset_;
+}
+
+class bit_iterator : public bit_iterator_base {
+ public:
+  typedef bit_reference reference;
+  typedef bit_reference* pointer;
+
+  bit_iterator() : bit_iterator_base(NULL, 0) {}
+  bit_iterator(bit_word_type* word, unsigned int offset)
+      : bit_iterator_base(word, offset) {}
+
+  reference operator*() const {
+    return reference(word_, bit_word_type(1) << offset_);
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  bit_iterator& operator++() {
+    bump_up();
+    return *this;
+  }
+
+  bit_iterator operator++(int) {
+    bit_iterator tmp = *this;
+    bump_up();
+    return tmp;
+  }
+
+  bit_iterator& operator--() {
+    bump_down();
+    return *this;
+  }
+
+  bit_iterator operator--(int) {
+    bit_iterator tmp = *this;
+    bump_down();
+    return tmp;
+  }
+
+  bit_iterator& operator+=(difference_type n) {
+    incr(n);
+    return *this;
+  }
+
+  bit_iterator& operator-=(difference_type n) {
+    incr(-n);
+    return *this;
+  }
+
+  bit_iterator operator+(difference_type n) const {
+    bit_iterator tmp = *this;
+    return tmp += n;
+  }
+
+  bit_iterator operator-(difference_type n) const {
+    bit_iterator tmp = *this;
+    return tmp -= n;
+  }
+};
+
+inline bit_iterator operator+(std::ptrdiff_t n, const bit_iterator& it) {
+  return it + n;
+}
+
+class const_bit_iterator : public bit_iterator_base {
+ public:
+  typedef bool reference;
+  typedef const bool* pointer;
+
+  const_bit_iterator() : bit_iterator_base(NULL, 0) {}
+  const_bit_iterator(bit_word_type* word, unsigned int offset)
+      : bit_iterator_base(word, offset) {}
+  const_bit_iterator(const bit_iterator& it)
+      : bit_iterator_base(it.word_, it.offset_) {}
+
+  reference operator*() const {
+    return (*word_ & (bit_word_type(1) << offset_)) != 0;
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  const_bit_iterator& operator++() {
+    bump_up();
+    return *this;
+  }
+
+  const_bit_iterator operator++(int) {
+    const_bit_iterator tmp = *this;
+    bump_up();
+    return tmp;
+  }
+
+  const_bit_iterator& operator--() {
+    bump_down();
+    return *this;
+  }
+
+  const_bit_iterator operator--(int) {
+    const_bit_iterator tmp = *this;
+    bump_down();
+    return tmp;
+  }
+
+  const_bit_iterator& operator+=(difference_type n) {
+    incr(n);
+    return *this;
+  }
+
+  const_bit_iterator& operator-=(difference_type n) {
+    incr(-n);
+    return *this;
+  }
+
+  const_bit_iterator operator+(difference_type n) const {
+    const_bit_iterator tmp = *this;
+    return tmp += n;
+  }
+
+  const_bit_iterator operator-(difference_type n) const {
+    const_bit_iterator tmp = *this;
+    return tmp -= n;
+  }
+};
+
+inline const_bit_iterator operator+(std::ptrdiff_t n,
+                                    const const_bit_iterator& it) {
+  return it + n;
+}
+
+// Packs one flag per bit into words of bits_per_word bits. Bits past size()
+// are always kept zero so whole-word operations stay exact.
+template <class Allocator>
+class vector<bool, Allocator> {
+ public:
+  typedef bool value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef bit_reference reference;
+  typedef bool const_reference;
+  typedef bit_reference* pointer;
+  typedef const bool* const_pointer;
+  typedef bit_iterator iterator;
+  typedef const_bit_iterator const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef bit_word_type word_type;
+
+ private:
+  typedef typename Allocator::template rebind<word_type>::other
+      word_allocator_type;
+
+ protected:
+  word_type* words_;
+  size_type size_;
+  size_type word_cap_;
+  word_allocator_type allocater_;
+
+ public:
+  vector()
+      : words_(NULL), size_(0), word_cap_(0), allocater_(allocator_type()){};
+
+  explicit vector(const Allocator& alloc)
+      : words_(NULL), size_(0), word_cap_(0), allocater_(alloc){};
+
+  explicit vector(size_type count, const bool& value = bool(),
+                  const Allocator& alloc = Allocator())
+      : words_(NULL), size_(0), word_cap_(0), allocater_(alloc) {
+    resize(count, value);
+  };
+
+  template <class InputIt>
+  vector(InputIt first,
+         typename enable_if<!is_integral<InputIt>::value, InputIt>::type last,
+         const Allocator& alloc = Allocator())
+      : words_(NULL), size_(0), word_cap_(0), allocater_(alloc) {
+    insert(end(), first, last);
+  };
+
+  vector(const vector& other)
+      : words_(NULL), size_(0), word_cap_(0), allocater_(other.allocater_) {
+    *this = other;
+  };
+
+  ~vector() { deallocate(); }
+
+  vector& operator=(const vector& other) {
+    if (this != &other) {
+      size_type old_size = size_;
+      if (other.size_ > capacity()) {
+        deallocate();
+        allocate(words_for(other.size_));
+        old_size = 0;
+      }
+      if (other.size_) {
+        std::memcpy(words_, other.words_,
+                    words_for(other.size_) * sizeof(word_type));
+      }
+      fill_bits(other.size_, old_size, false);
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  // Iterators-------------------------------------------
+
+  iterator begin() { return iterator(words_, 0); }
+  const_iterator begin() const { return const_iterator(words_, 0); }
+
+  iterator end() { return begin() + size_; }
+  const_iterator end() const { return begin() + size_; }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); };
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  };
+
+  reverse_iterator rend() { return reverse_iterator(begin()); };
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  };
+
+  // Capacity-------------------------------------------
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const {
+    size_type max_bits = std::numeric_limits<difference_type>::max();
+    size_type max_words = allocater_.max_size();
+    if (max_words > max_bits / bits_per_word) return max_bits;
+    return max_words * bits_per_word;
+  }
+
+  void resize(size_type n, bool val = false) {
+    if (n < size_) {
+      fill_bits(n, size_, false);
+      size_ = n;
+    } else if (n > size_) {
+      reserve(calc_new_cap(n));
+      fill_bits(size_, n, val);
+      size_ = n;
+    }
+  };
+
+  size_type capacity() const { return word_cap_ * bits_per_word; };
+
+  bool empty() const { return size_ == 0; };
+
+  void reserve(size_type n) {
+    if (capacity() >= n) return;
+
+    if (n > max_size()) {
+      throw std::length_error("ft::vector<bool> reserve() length_error");
+    }
+    reallocate(words_for(n));
+  }
+
+  void shrink_to_fit() {
+    if (word_cap_ > words_for(size_)) {
+      reallocate(words_for(size_));
+    }
+  }
+
+  // Element access-------------------------------------
+
+  reference operator[](size_type pos) { return *(begin() + pos); }
+
+  const_reference operator[](size_type pos) const {
+    return *(begin() + pos);
+  }
+
+  reference at(size_type pos) {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::vector<bool> at() out_of_range");
+    }
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (!(pos < size())) {
+      throw std::out_of_range("ft::vector<bool> at() out_of_range");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() { return *begin(); }
+
+  const_reference front() const { return *begin(); }
+
+  reference back() { return *(end() - 1); }
+
+  const_reference back() const { return *(end() - 1); }
+
+  // Modifiers------------------------------------------
+
+  void assign(size_type count, const bool& value) {
+    size_ = 0;
+    resize(count, value);
+  }
+
+  template <class InputIt>
+  void assign(
+      InputIt first,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void push_back(const bool& val) {
+    if (size_ == capacity()) {
+      reserve(calc_new_cap(size_ + 1));
+    }
+    size_++;
+    back() = val;
+  }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    back() = false;
+    size_--;
+  }
+
+  iterator insert(iterator pos, const bool& value) {
+    difference_type offset = pos - begin();
+    insert(pos, 1, value);
+    return begin() + offset;
+  }
+
+  void insert(iterator pos, size_type count, const bool& value) {
+    size_type offset = insert_helper(pos, count);
+    fill_bits(offset, offset + count, value);
+  }
+
+  template <class InputIt>
+  void insert(
+      iterator pos,
+      typename enable_if<!is_integral<InputIt>::value, InputIt>::type first,
+      InputIt last) {
+    insert_range(pos, first, last,
+                 typename iterator_traits<InputIt>::iterator_category());
+  }
+
+  iterator erase(iterator position) { return erase(position, position + 1); };
+
+  iterator erase(iterator first, iterator last) {
+    difference_type offset = first - begin();
+    std::copy(last, end(), first);
+    resize(size_ - (last - first));
+    return begin() + offset;
+  };
+
+  void clear() {
+    if (words_ != NULL) {
+      std::memset(words_, 0, words_for(size_) * sizeof(word_type));
+    }
+    size_ = 0;
+  }
+
+  void swap(vector& other) {
+    std::swap(words_, other.words_);
+    std::swap(size_, other.size_);
+    std::swap(word_cap_, other.word_cap_);
+    std::swap(allocater_, other.allocater_);
+  }
+
+  static void swap(reference x, reference y) { ft::swap(x, y); }
+
+  allocator_type get_allocator() const { return allocator_type(allocater_); }
+
+  // Bit operations-------------------------------------
+
+  void flip() {
+    for (size_type i = 0; i < words_for(size_); i++) {
+      words_[i] = ~words_[i];
+    }
+    if (size_ % bits_per_word) {
+      words_[size_ / bits_per_word] &= low_mask(size_ % bits_per_word);
+    }
+  }
+
+  vector& set() {
+    fill_bits(0, size_, true);
+    return *this;
+  }
+
+  vector& set(size_type pos, bool val = true) {
+    at(pos) = val;
+    return *this;
+  }
+
+  vector& reset() {
+    fill_bits(0, size_, false);
+    return *this;
+  }
+
+  vector& reset(size_type pos) { return set(pos, false); }
+
+  size_type count() const {
+    size_type res = 0;
+    for (size_type i = 0; i < words_for(size_); i++) {
+      res += __builtin_popcountl(words_[i]);
+    }
+    return res;
+  }
+
+  size_type find_first() const { return find_from(0); }
+
+  size_type find_next(size_type pos) const {
+    if (pos + 1 >= size_) return size_;
+    return find_from(pos + 1);
+  }
+
+  vector& operator&=(const vector& other) {
+    check_same_size(other, "ft::vector<bool> operator&= size mismatch");
+    for (size_type i = 0; i < words_for(size_); i++) {
+      words_[i] &= other.words_[i];
+    }
+    return *this;
+  }
+
+  vector& operator|=(const vector& other) {
+    check_same_size(other, "ft::vector<bool> operator|= size mismatch");
+    for (size_type i = 0; i < words_for(size_); i++) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  vector& operator^=(const vector& other) {
+    check_same_size(other, "ft::vector<bool> operator^= size mismatch");
+    for (size_type i = 0; i < words_for(size_); i++) {
+      words_[i] ^= other.words_[i];
+    }
+    return *this;
+  }
+
+  const word_type* data() const { return words_; }
+
+ private:
+  static size_type words_for(size_type bits) {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+
+  static word_type low_mask(size_type bits) {
+    return bits == 0 ? 0 : ~word_type(0) >> (bits_per_word - bits);
+  }
+
+  void allocate(size_type n_words) {
+    words_ = allocater_.allocate(n_words);
+    word_cap_ = n_words;
+    std::memset(words_, 0, n_words * sizeof(word_type));
+  }
+
+  void deallocate() {
+    if (words_ != NULL) {
+      allocater_.deallocate(words_, word_cap_);
+    }
+    words_ = NULL;
+    word_cap_ = 0;
+  }
+
+  void reallocate(size_type n_words) {
+    word_type* old_words = words_;
+    size_type old_cap = word_cap_;
+
+    words_ = NULL;
+    word_cap_ = 0;
+    if (n_words) {
+      allocate(n_words);
+      if (old_words != NULL) {
+        std::memcpy(words_, old_words, words_for(size_) * sizeof(word_type));
+      }
+    }
+    if (old_words != NULL) {
+      allocater_.deallocate(old_words, old_cap);
+    }
+  }
+
+  void fill_bits(size_type first, size_type last, bool val) {
+    if (first >= last) return;
+
+    size_type first_word = first / bits_per_word;
+    size_type last_word = (last - 1) / bits_per_word;
+    word_type head = ~low_mask(first % bits_per_word);
+    word_type tail = low_mask(last - last_word * bits_per_word);
+
+    if (first_word == last_word) {
+      apply_mask(words_[first_word], head & tail, val);
+      return;
+    }
+    apply_mask(words_[first_word], head, val);
+    for (size_type i = first_word + 1; i < last_word; i++) {
+      words_[i] = val ? ~word_type(0) : 0;
+    }
+    apply_mask(words_[last_word], tail, val);
+  }
+
+  static void apply_mask(word_type& word, word_type mask, bool val) {
+    if (val) {
+      word |= mask;
+    } else {
+      word &= ~mask;
+    }
+  }
+
+  size_type find_from(size_type pos) const {
+    size_type i = pos / bits_per_word;
+    size_type n_words = words_for(size_);
+    if (i >= n_words) return size_;
+
+    word_type word = words_[i] & ~low_mask(pos % bits_per_word);
+    while (word == 0) {
+      if (++i == n_words) return size_;
+      word = words_[i];
+    }
+    return i * bits_per_word + __builtin_ctzl(word);
+  }
+
+  void check_same_size(const vector& other, const char* what) const {
+    if (size_ != other.size_) {
+      throw std::invalid_argument(what);
+    }
+  }
+
+  size_type calc_new_cap(size_type new_cap) {
+    size_type current_cap = capacity();
+    if (current_cap >= new_cap) return current_cap;
+    return std::max(current_cap * 2, new_cap);
+  }
+
+  size_type insert_helper(iterator pos, size_type count) {
+    size_type offset = pos - begin();
+    size_type old_size = size_;
+
+    if (capacity() < size_ + count) {
+      reserve(calc_new_cap(size_ + count));
+    }
+    size_ += count;
+    std::copy_backward(begin() + offset, begin() + old_size, end());
+    return offset;
+  }
+
+  template <class InputIt>
+  void insert_range(iterator pos, InputIt first, InputIt last,
+                    std::input_iterator_tag) {
+    vector tmp;
+    for (; first != last; ++first) {
+      tmp.push_back(*first);
+    }
+    insert(pos, tmp.begin(), tmp.end());
+  }
+
+  template <class ForwardIt>
+  void insert_range(iterator pos, ForwardIt first, ForwardIt last,
+                    std::forward_iterator_tag) {
+    size_type offset = insert_helper(pos, std::distance(first, last));
+    std::copy(first, last, begin() + offset);
+  }
+};
+
+template <class Alloc>
+bool operator==(const vector<bool, Alloc>& lhs,
+                const vector<bool, Alloc>& rhs) {
+  return lhs.size() == rhs.size() &&
+         (lhs.size() == 0 ||
+          std::memcmp(lhs.data(), rhs.data(),
+                      (lhs.size() + bits_per_word - 1) / bits_per_word *
+                          sizeof(bit_word_type)) == 0);
+}
+
+}  // namespace ft
+
+#endif /* ***************************************************** VECTOR_BOOL_H \
+        */
\ No newline at end of file
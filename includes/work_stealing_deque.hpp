@@ -0,0 +1,171 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "atomic.hpp"
+#include "enable_if.hpp"
+
+namespace ft {
+
+// Chase-Lev work-stealing deque. The owning thread pushes and pops at the
+// bottom; any other thread may steal from the top. Only the last element is
+// contended, so the owner normally pays for a single fence per pop.
+//
+// Thieves read a slot before claiming it, so elements are limited to
+// integers and pointers that can be loaded atomically; store task pointers
+// or indices rather than the tasks themselves. Storage grows by doubling
+// and replaced arrays are kept until destruction because a thief may still
+// be reading from them.
+template <class T, class Allocator = std::allocator<T> >
+class work_stealing_deque {
+ public:
+  typedef typename enable_if<is_integral<T>::value || is_pointer<T>::value,
+                             T>::type value_type;
+  typedef Allocator allocator_type;
+  typedef std::size_t size_type;
+
+ private:
+  struct array {
+    long mask;
+    T* slots;
+    array* retired;
+
+    T load(long i) const { return atomic_load_relaxed(&slots[i & mask]); }
+    void store(long i, T value) {
+      atomic_store_relaxed(&slots[i & mask], value);
+    }
+  };
+
+  typedef typename Allocator::template rebind<array>::other array_allocator;
+
+  char pad0_[cache_line_size];
+  long top_;
+  char pad1_[cache_line_size - sizeof(long)];
+  long bottom_;
+  array* array_;
+  allocator_type allocater_;
+  array_allocator array_allocater_;
+
+ public:
+  explicit work_stealing_deque(size_type capacity = 64,
+                               const Allocator& alloc = Allocator())
+      : top_(0),
+        bottom_(0),
+        array_(NULL),
+        allocater_(alloc),
+        array_allocater_(alloc) {
+    size_type cap = 1;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    array_ = allocate_array(cap, NULL);
+  }
+
+  ~work_stealing_deque() {
+    while (array_ != NULL) {
+      array* retired = array_->retired;
+      allocater_.deallocate(array_->slots, array_->mask + 1);
+      array_allocater_.deallocate(array_, 1);
+      array_ = retired;
+    }
+  }
+
+  // Capacity-------------------------------------------
+
+  // Only a snapshot when other threads are running.
+  size_type size() const {
+    long t = atomic_load_acquire(&top_);
+    long b = atomic_load_acquire(&bottom_);
+    return b > t ? b - t : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  size_type capacity() const {
+    return atomic_load_acquire(&array_)->mask + 1;
+  }
+
+  // Owner----------------------------------------------
+
+  void push(value_type value) {
+    long b = atomic_load_relaxed(&bottom_);
+    long t = atomic_load_acquire(&top_);
+    array* a = atomic_load_relaxed(&array_);
+    if (b - t > a->mask) {
+      a = grow(a, t, b);
+    }
+    a->store(b, value);
+    atomic_store_release(&bottom_, b + 1);
+  }
+
+  // Returns false when the deque is empty or a thief took the last element
+  // first; out is only written on success.
+  bool pop(value_type& out) {
+    long b = atomic_load_relaxed(&bottom_) - 1;
+    array* a = atomic_load_relaxed(&array_);
+    atomic_store_relaxed(&bottom_, b);
+    atomic_thread_fence();
+    long t = atomic_load_relaxed(&top_);
+
+    if (t > b) {
+      atomic_store_relaxed(&bottom_, b + 1);
+      return false;
+    }
+    value_type value = a->load(b);
+    if (t == b) {
+      // Last element: race the thieves for it.
+      bool won = atomic_compare_exchange(&top_, &t, t + 1);
+      atomic_store_relaxed(&bottom_, b + 1);
+      if (!won) return false;
+    }
+    out = value;
+    return true;
+  }
+
+  // Thieves--------------------------------------------
+
+  // Returns false when the deque is empty or another thread took the top
+  // element first.
+  bool steal(value_type& out) {
+    long t = atomic_load_acquire(&top_);
+    atomic_thread_fence();
+    long b = atomic_load_acquire(&bottom_);
+    if (t >= b) return false;
+
+    array* a = atomic_load_acquire(&array_);
+    value_type value = a->load(t);
+    if (!atomic_compare_exchange(&top_, &t, t + 1)) return false;
+    out = value;
+    return true;
+  }
+
+  allocator_type get_allocator() const { return allocater_; }
+
+ private:
+  work_stealing_deque(const work_stealing_deque&);
+  work_stealing_deque& operator=(const work_stealing_deque&);
+
+  array* allocate_array(size_type cap, array* retired) {
+    array* a = array_allocater_.allocate(1);
+    a->mask = static_cast<long>(cap) - 1;
+    a->slots = allocater_.allocate(cap);
+    a->retired = retired;
+    return a;
+  }
+
+  array* grow(array* a, long t, long b) {
+    array* bigger = allocate_array((a->mask + 1) * 2, a);
+    for (long i = t; i < b; i++) {
+      bigger->store(i, a->load(i));
+    }
+    atomic_store_release(&array_, bigger);
+    return bigger;
+  }
+};
+
+}  // namespace ft
+
+#endif /* ********************************************* WORK_STEALING_DEQUE_H \
+        */
\ No newline at end of file
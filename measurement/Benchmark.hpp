@@ -0,0 +1,450 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "PerfCounters.hpp"
+#include "Report.hpp"
+
+// Benchmark harness used by the measure_*.cpp programs.
+//
+// A case is run in samples. Every sample executes the body iterations()
+// times and records the elapsed time per iteration. The runner first doubles
+// the iteration count until one sample takes at least the minimum time, then
+// runs a few warmup samples that are thrown away and finally the measured
+// repetitions. The report holds the median, min, mean, stddev and tail
+// percentiles of the samples in nanoseconds per operation; an iteration is
+// one operation unless the case says it performs several.
+//
+// Tuned through the environment:
+//   BENCH_MIN_TIME  minimum time of one sample in ms (default 5)
+//   BENCH_WARMUP    warmup samples (default 2)
+//   BENCH_REPS      measured samples (default 15)
+//   BENCH_CLOCK     "wall" (default) or "cpu", the clock the stats are on
+//   BENCH_FILTER    only run cases whose name contains this string
+//   BENCH_FORMAT    "tsv" (default), "csv" or "json", see Report.hpp
+//   BENCH_LABEL     free text stored in the CSV and JSON context
+//   BENCH_PERF      "1" to add hardware counters per operation to the report
+//   BENCH_SWEEP_MAX largest size of sweep_sizes() (default 10^6); 10^8 needs
+//                   several GB for node based containers
+//   BENCH_LATENCY_OPS operations timed one by one per case of
+//                   measure_latency (default 10^6)
+
+namespace bench {
+
+typedef long long nanoseconds;
+
+// Makes the compiler believe value is read, so neither it nor the
+// computation that produced it can be removed. The memory clobber also
+// keeps loop-invariant loads from being hoisted out of the timed loop.
+template <class T>
+inline void do_not_optimize(const T& value) {
+  __asm__ __volatile__("" : : "r,m"(value) : "memory");
+}
+
+// Forces pending stores to be treated as visible.
+inline void clobber_memory() { __asm__ __volatile__("" : : : "memory"); }
+
+inline nanoseconds now(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return static_cast<nanoseconds>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+struct options {
+  nanoseconds min_time;
+  size_t warmup;
+  size_t repetitions;
+  bool cpu_clock;
+  const char* filter;
+  bool perf;
+  size_t sweep_max;
+  size_t latency_ops;
+
+  static const options& get() {
+    static const options opts = from_env();
+    return opts;
+  }
+
+ private:
+  static options from_env() {
+    options opts;
+    opts.min_time = static_cast<nanoseconds>(env("BENCH_MIN_TIME", 5) * 1e6);
+    opts.warmup = static_cast<size_t>(env("BENCH_WARMUP", 2));
+    opts.repetitions = std::max(static_cast<size_t>(env("BENCH_REPS", 15)),
+                                static_cast<size_t>(1));
+    const char* clock = getenv("BENCH_CLOCK");
+    opts.cpu_clock = clock != NULL && strcmp(clock, "cpu") == 0;
+    opts.filter = getenv("BENCH_FILTER");
+    opts.perf = env("BENCH_PERF", 0) != 0;
+    opts.sweep_max = static_cast<size_t>(env("BENCH_SWEEP_MAX", 1e6));
+    opts.latency_ops = static_cast<size_t>(env("BENCH_LATENCY_OPS", 1e6));
+    return opts;
+  }
+
+  static double env(const char* name, double fallback) {
+    const char* value = getenv(name);
+    return value != NULL && *value != '\0' ? strtod(value, NULL) : fallback;
+  }
+};
+
+// Linear interpolation between the closest ranks of a sorted sample.
+inline double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  double rank = p / 100 * (sorted.size() - 1);
+  size_t lo = static_cast<size_t>(rank);
+  size_t hi = std::min(lo + 1, sorted.size() - 1);
+  return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - lo);
+}
+
+inline stats summarize(std::vector<double> samples) {
+  stats s = stats();
+  if (samples.empty()) return s;
+  std::sort(samples.begin(), samples.end());
+  double sum = 0;
+  for (size_t i = 0; i < samples.size(); i++) {
+    sum += samples[i];
+  }
+  s.mean = sum / samples.size();
+  double sq = 0;
+  for (size_t i = 0; i < samples.size(); i++) {
+    sq += (samples[i] - s.mean) * (samples[i] - s.mean);
+  }
+  s.stddev = samples.size() > 1 ? std::sqrt(sq / (samples.size() - 1)) : 0;
+  s.min = samples.front();
+  s.median = percentile(samples, 50);
+  s.p90 = percentile(samples, 90);
+  s.p99 = percentile(samples, 99);
+  s.max = samples.back();
+  return s;
+}
+
+// Sizes for parameterized cases: 10^2, 3*10^2, 10^3, ... up to
+// BENCH_SWEEP_MAX.
+inline std::vector<size_t> sweep_sizes() {
+  std::vector<size_t> sizes;
+  size_t max = options::get().sweep_max;
+  for (size_t decade = 100; decade <= max; decade *= 10) {
+    sizes.push_back(decade);
+    if (decade <= max / 3) sizes.push_back(decade * 3);
+    if (decade > max / 10) break;
+  }
+  return sizes;
+}
+
+// xorshift64*: fast, deterministic and the same for the std and ft builds,
+// so both run exactly the same key sequence.
+class rng {
+ public:
+  explicit rng(unsigned long long seed = 0x9e3779b97f4a7c15ULL)
+      : state_(seed != 0 ? seed : 1) {}
+
+  unsigned long long next() {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return state_ * 0x2545f4914f6cdd1dULL;
+  }
+
+  // Uniform in [0, n) for n > 0.
+  size_t below(size_t n) { return static_cast<size_t>(next() % n); }
+
+ private:
+  unsigned long long state_;
+};
+
+// count indices uniform in [0, n). Probing a container through such a table
+// costs one sequential, prefetched load per operation.
+inline std::vector<unsigned int> random_indices(size_t n, size_t count,
+                                                unsigned long long seed = 1) {
+  rng gen(seed);
+  std::vector<unsigned int> indices(count);
+  for (size_t i = 0; i < count; i++) {
+    indices[i] = static_cast<unsigned int>(gen.below(n));
+  }
+  return indices;
+}
+
+// 0 .. n-1 in random order.
+inline std::vector<int> shuffled(size_t n, unsigned long long seed = 1) {
+  rng gen(seed);
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; i++) {
+    keys[i] = static_cast<int>(i);
+  }
+  for (size_t i = n; i > 1; i--) {
+    std::swap(keys[i - 1], keys[gen.below(i)]);
+  }
+  return keys;
+}
+
+class runner {
+ public:
+  explicit runner(const char* name)
+      : name_(name),
+        family_(name),
+        param_(0),
+        sized_(false),
+        ops_(1),
+        opts_(options::get()),
+        phase_(calibrating),
+        iterations_(1),
+        warmups_(0),
+        started_(false),
+        wall_(0),
+        cpu_(0),
+        wall_start_(0),
+        cpu_start_(0),
+        sample_start_(0),
+        perf_(opts_.perf ? &shared_counters() : NULL),
+        perf_iterations_(0) {
+    init();
+  }
+
+  // A case at size param, reported as "name/param". Every iteration counts
+  // as ops operations.
+  runner(const char* name, size_t param, size_t ops = 1)
+      : name_(name),
+        family_(name),
+        param_(param),
+        sized_(true),
+        ops_(std::max(ops, static_cast<size_t>(1))),
+        opts_(options::get()),
+        phase_(calibrating),
+        iterations_(1),
+        warmups_(0),
+        started_(false),
+        wall_(0),
+        cpu_(0),
+        wall_start_(0),
+        cpu_start_(0),
+        sample_start_(0),
+        perf_(opts_.perf ? &shared_counters() : NULL),
+        perf_iterations_(0) {
+    std::ostringstream full;
+    full << name << '/' << param;
+    name_ = full.str();
+    init();
+  }
+
+  // Closes the previous sample and tells whether another one is needed.
+  bool next() {
+    if (phase_ == skipped) return false;
+    if (started_) record();
+    started_ = true;
+    wall_ = 0;
+    cpu_ = 0;
+    sample_start_ = now(CLOCK_MONOTONIC);
+    return phase_ != done;
+  }
+
+  size_t iterations() const { return iterations_; }
+
+  // Time is accumulated over every start()/stop() pair of a sample, so the
+  // body of BENCH_EACH can leave its setup out of the measurement.
+  // The counters are only read in measured samples and are switched on
+  // outside the clock reads, so the ioctls do not show up in the times.
+  void start() {
+    if (counting()) perf_->start();
+    cpu_start_ = now(CLOCK_PROCESS_CPUTIME_ID);
+    wall_start_ = now(CLOCK_MONOTONIC);
+  }
+
+  void stop() {
+    wall_ += now(CLOCK_MONOTONIC) - wall_start_;
+    cpu_ += now(CLOCK_PROCESS_CPUTIME_ID) - cpu_start_;
+    if (counting()) perf_->stop(perf_totals_);
+  }
+
+  const std::string& name() const { return name_; }
+
+  size_t param() const { return param_; }
+
+  const std::vector<double>& wall_samples() const { return wall_samples_; }
+
+  const std::vector<double>& cpu_samples() const { return cpu_samples_; }
+
+  const std::vector<double>& samples() const {
+    return opts_.cpu_clock ? cpu_samples_ : wall_samples_;
+  }
+
+  void report() const {
+    if (phase_ == skipped) return;
+    result r;
+    r.name = name_;
+    r.family = family_;
+    r.param = param_;
+    r.sized = sized_;
+    r.ops_per_iteration = ops_;
+    r.iterations = iterations_;
+    r.clock = opts_.cpu_clock ? "cpu" : "wall";
+    r.summary = summarize(samples());
+    r.wall_median = summarize(wall_samples_).median;
+    r.cpu_median = summarize(cpu_samples_).median;
+    r.samples = samples();
+    if (perf_ != NULL) {
+      for (int i = 0; i < perf_counters::event_count; i++) {
+        counter c;
+        c.name = perf_counters::name(i);
+        c.available = perf_->available(i) && perf_iterations_ > 0;
+        c.per_op = c.available ? perf_totals_[i] / perf_iterations_ / ops_ : 0;
+        r.counters.push_back(c);
+      }
+    }
+    reporter::get().add(r);
+  }
+
+ private:
+  enum phase { calibrating, warming_up, measuring, done, skipped };
+
+  static size_t max_iterations() { return 1000000000; }
+
+  void init() {
+    for (int i = 0; i < perf_counters::event_count; i++) {
+      perf_totals_[i] = 0;
+    }
+    if (opts_.filter != NULL && name_.find(opts_.filter) == std::string::npos) {
+      phase_ = skipped;
+    }
+  }
+
+  static perf_counters& shared_counters() {
+    static perf_counters counters;
+    return counters;
+  }
+
+  bool counting() const { return perf_ != NULL && phase_ == measuring; }
+
+  void record() {
+    nanoseconds elapsed = opts_.cpu_clock ? cpu_ : wall_;
+    // Untimed setup counts here, so a cheap body behind an expensive setup
+    // stops calibrating instead of asking for endless setups.
+    nanoseconds total = now(CLOCK_MONOTONIC) - sample_start_;
+    switch (phase_) {
+      case calibrating:
+        if (elapsed >= opts_.min_time || total >= 10 * opts_.min_time ||
+            iterations_ >= max_iterations()) {
+          phase_ = opts_.warmup > 0 ? warming_up : measuring;
+        } else {
+          iterations_ = next_iterations(elapsed);
+        }
+        break;
+      case warming_up:
+        if (++warmups_ >= opts_.warmup) phase_ = measuring;
+        break;
+      case measuring:
+        wall_samples_.push_back(static_cast<double>(wall_) / ops());
+        cpu_samples_.push_back(static_cast<double>(cpu_) / ops());
+        perf_iterations_ += iterations_;
+        if (wall_samples_.size() >= opts_.repetitions) phase_ = done;
+        break;
+      default:
+        break;
+    }
+  }
+
+  double ops() const { return static_cast<double>(iterations_) * ops_; }
+
+  // Aims a little past the minimum time from the last sample's rate, but
+  // never grows by more than 10x at once so one lucky sample cannot blow up
+  // the count.
+  size_t next_iterations(nanoseconds elapsed) const {
+    double factor = 10;
+    if (elapsed > 0) {
+      factor = std::min(factor, 1.4 * opts_.min_time / elapsed);
+    }
+    size_t n = static_cast<size_t>(iterations_ * std::max(factor, 2.0));
+    return std::min(n, max_iterations());
+  }
+
+  std::string name_;
+  std::string family_;
+  size_t param_;
+  bool sized_;
+  size_t ops_;
+  const options& opts_;
+  phase phase_;
+  size_t iterations_;
+  size_t warmups_;
+  bool started_;
+  nanoseconds wall_;
+  nanoseconds cpu_;
+  nanoseconds wall_start_;
+  nanoseconds cpu_start_;
+  nanoseconds sample_start_;
+  perf_counters* perf_;
+  double perf_totals_[perf_counters::event_count];
+  size_t perf_iterations_;
+  std::vector<double> wall_samples_;
+  std::vector<double> cpu_samples_;
+};
+
+}  // namespace bench
+
+// Iteration count of the current sample and index of the current iteration,
+// for cases whose setup or body depends on them.
+#define BENCH_N bench_runner_.iterations()
+#define BENCH_I bench_i_
+
+// Times body BENCH_N times per sample. setup runs untimed at the start of
+// every sample and may size its data with BENCH_N, e.g. to have enough
+// elements for BENCH_N calls to pop().
+#define BENCH_SETUP(name, setup, body) BENCH_SETUP_RUN((name), setup, body)
+
+#define BENCH(name, body) BENCH_SETUP(name, (void)0, body)
+
+// Runs setup untimed before every single iteration; objects declared in body
+// are also destroyed after the clock stops. Meant for bodies that consume
+// their input and take far longer than reading the clock.
+#define BENCH_EACH(name, setup, body) BENCH_EACH_RUN((name), setup, body)
+
+// Parameterized forms, reported as "name/n" with each iteration counting as
+// ops operations, e.g. one traversal of an n element container.
+#define BENCH_SETUP_SIZED(name, n, ops, setup, body) \
+  BENCH_SETUP_RUN((name, n, ops), setup, body)
+
+#define BENCH_SIZED(name, n, ops, body) \
+  BENCH_SETUP_SIZED(name, n, ops, (void)0, body)
+
+#define BENCH_EACH_SIZED(name, n, ops, setup, body) \
+  BENCH_EACH_RUN((name, n, ops), setup, body)
+
+#define BENCH_SETUP_RUN(args, setup, body)                                 \
+  {                                                                        \
+    bench::runner bench_runner_ args;                                      \
+    while (bench_runner_.next()) {                                         \
+      setup;                                                               \
+      const size_t bench_n_ = BENCH_N;                                     \
+      bench_runner_.start();                                               \
+      for (size_t bench_i_ = 0; bench_i_ < bench_n_; bench_i_++) {         \
+        body;                                                              \
+      }                                                                    \
+      bench_runner_.stop();                                                \
+    }                                                                      \
+    bench_runner_.report();                                                \
+  }
+
+#define BENCH_EACH_RUN(args, setup, body)                                  \
+  {                                                                        \
+    bench::runner bench_runner_ args;                                      \
+    while (bench_runner_.next()) {                                         \
+      for (size_t bench_i_ = 0; bench_i_ < BENCH_N; bench_i_++) {          \
+        setup;                                                             \
+        bench_runner_.start();                                             \
+        body;                                                              \
+        bench_runner_.stop();                                              \
+      }                                                                    \
+    }                                                                      \
+    bench_runner_.report();                                                \
+  }
+
+#endif /* ******************************************************* BENCHMARK_H \
+        */
\ No newline at end of file
@@ -0,0 +1,185 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <time.h>
+
+#include <vector>
+
+namespace bench {
+
+// Log-linear histogram in the style of HdrHistogram. Values below 128 get a
+// bucket each; above that every power of two is split into 64 linear
+// sub-buckets, so a recorded value is off by less than 1/64 (1.6%) whatever
+// its magnitude. Recording is one bit scan and an increment, cheap enough
+// to sit between two reads of the clock.
+class histogram {
+ public:
+  histogram()
+      : counts_(bucket_count(), 0), total_(0), sum_(0), min_(~0ULL), max_(0) {}
+
+  void record(unsigned long long value) {
+    counts_[index_of(value)]++;
+    total_++;
+    sum_ += value;
+    if (value < min_) min_ = value;
+    if (value > max_) max_ = value;
+  }
+
+  void merge(const histogram& other) {
+    for (size_t i = 0; i < counts_.size(); i++) {
+      counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+    sum_ += other.sum_;
+    if (other.min_ < min_) min_ = other.min_;
+    if (other.max_ > max_) max_ = other.max_;
+  }
+
+  void reset() {
+    counts_.assign(counts_.size(), 0);
+    total_ = 0;
+    sum_ = 0;
+    min_ = ~0ULL;
+    max_ = 0;
+  }
+
+  unsigned long long count() const { return total_; }
+
+  unsigned long long min() const { return total_ > 0 ? min_ : 0; }
+
+  unsigned long long max() const { return max_; }
+
+  double mean() const {
+    return total_ > 0 ? static_cast<double>(sum_) / total_ : 0;
+  }
+
+  // Smallest value v such that at least p percent of the recorded values
+  // are <= v, rounded up to the end of its bucket and capped at max().
+  unsigned long long percentile(double p) const {
+    if (total_ == 0) return 0;
+    unsigned long long rank =
+        static_cast<unsigned long long>(p / 100 * total_ + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > total_) rank = total_;
+    unsigned long long seen = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+      seen += counts_[i];
+      if (seen >= rank) {
+        unsigned long long high = highest_in(i);
+        return high < max_ ? high : max_;
+      }
+    }
+    return max_;
+  }
+
+ private:
+  static const unsigned linear = 128;
+  static const unsigned sub_buckets = 64;
+  static const unsigned sub_bits = 6;
+
+  static size_t bucket_count() {
+    return linear + (63 - sub_bits) * sub_buckets;
+  }
+
+  static size_t index_of(unsigned long long value) {
+    if (value < linear) return static_cast<size_t>(value);
+    unsigned shift = 63 - __builtin_clzll(value) - sub_bits;
+    return linear + (shift - 1) * sub_buckets +
+           static_cast<size_t>(value >> shift) - sub_buckets;
+  }
+
+  static unsigned long long highest_in(size_t index) {
+    if (index < linear) return index;
+    unsigned shift = static_cast<unsigned>((index - linear) / sub_buckets) + 1;
+    unsigned long long sub = (index - linear) % sub_buckets + sub_buckets;
+    return ((sub + 1) << shift) - 1;
+  }
+
+  std::vector<unsigned long long> counts_;
+  unsigned long long total_;
+  unsigned long long sum_;
+  unsigned long long min_;
+  unsigned long long max_;
+};
+
+// Clock for timing single operations. On x86 it reads the time stamp
+// counter behind an lfence, which keeps earlier instructions from leaking
+// past the read, and converts ticks to ns with a rate measured once against
+// CLOCK_MONOTONIC; elsewhere it falls back to CLOCK_MONOTONIC.
+class op_timer {
+ public:
+  static op_timer& get() {
+    static op_timer timer;
+    return timer;
+  }
+
+  static unsigned long long ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int lo;
+    unsigned int hi;
+    __asm__ __volatile__("lfence\n\trdtsc" : "=a"(lo), "=d"(hi) : : "memory");
+    return (static_cast<unsigned long long>(hi) << 32) | lo;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<unsigned long long>(ts.tv_sec) * 1000000000ULL +
+           ts.tv_nsec;
+#endif
+  }
+
+  // Elapsed ns between two ticks() readings, less the cost of the readings.
+  unsigned long long ns(unsigned long long start,
+                        unsigned long long end) const {
+    double elapsed = (end - start) * ns_per_tick_ - overhead_ns_;
+    return elapsed > 0 ? static_cast<unsigned long long>(elapsed + 0.5) : 0;
+  }
+
+  const char* source() const {
+#if defined(__x86_64__) || defined(__i386__)
+    return "rdtsc";
+#else
+    return "clock_gettime";
+#endif
+  }
+
+  double overhead_ns() const { return overhead_ns_; }
+
+ private:
+  op_timer() : ns_per_tick_(1), overhead_ns_(0) {
+#if defined(__x86_64__) || defined(__i386__)
+    struct timespec start_ts;
+    struct timespec end_ts;
+    clock_gettime(CLOCK_MONOTONIC, &start_ts);
+    unsigned long long start = ticks();
+    do {
+      clock_gettime(CLOCK_MONOTONIC, &end_ts);
+    } while ((end_ts.tv_sec - start_ts.tv_sec) * 1000000000LL +
+                 (end_ts.tv_nsec - start_ts.tv_nsec) <
+             20000000);
+    unsigned long long end = ticks();
+    ns_per_tick_ = ((end_ts.tv_sec - start_ts.tv_sec) * 1e9 +
+                    (end_ts.tv_nsec - start_ts.tv_nsec)) /
+                   (end - start);
+#endif
+    // The cheapest of many back to back readings is what every
+    // measurement pays on top of the operation.
+    unsigned long long best = ~0ULL;
+    for (int i = 0; i < 1000; i++) {
+      unsigned long long a = ticks();
+      unsigned long long b = ticks();
+      if (b - a < best) best = b - a;
+    }
+    overhead_ns_ = best * ns_per_tick_;
+  }
+
+  op_timer(const op_timer&);
+  op_timer& operator=(const op_timer&);
+
+  double ns_per_tick_;
+  double overhead_ns_;
+};
+
+}  // namespace bench
+
+#endif /* ******************************************************* HISTOGRAM_H \
+        */
\ No newline at end of file
@@ -0,0 +1,170 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+// Hardware counters of the calling process, read through perf_event_open.
+// Each event has its own file descriptor so the kernel can multiplex them
+// when the PMU has fewer counters than events; counts are scaled by the
+// fraction of time an event was actually scheduled. Events the kernel or
+// the machine does not support (containers, VMs without a virtual PMU,
+// perf_event_paranoid > 2) are reported as unavailable instead of failing
+// the run. Only user-space work is counted.
+class perf_counters {
+ public:
+  enum event {
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    branch_misses,
+    dtlb_misses,
+    event_count
+  };
+
+  perf_counters() {
+    for (int i = 0; i < event_count; i++) {
+      fds_[i] = open_event(static_cast<event>(i));
+    }
+  }
+
+  ~perf_counters() {
+    for (int i = 0; i < event_count; i++) {
+      if (fds_[i] >= 0) close(fds_[i]);
+    }
+  }
+
+  static const char* name(int e) {
+    static const char* const names[event_count] = {
+        "cycles",     "instructions",  "l1d_misses",
+        "llc_misses", "branch_misses", "dtlb_misses"};
+    return names[e];
+  }
+
+  bool available(int e) const { return fds_[e] >= 0; }
+
+  bool any_available() const {
+    for (int i = 0; i < event_count; i++) {
+      if (available(i)) return true;
+    }
+    return false;
+  }
+
+  void start() {
+    for (int i = 0; i < event_count; i++) {
+      if (fds_[i] < 0) continue;
+      control(fds_[i], reset);
+      control(fds_[i], enable);
+    }
+  }
+
+  // Stops counting and adds the counts since start() to totals.
+  void stop(double* totals) {
+    for (int i = 0; i < event_count; i++) {
+      if (fds_[i] >= 0) control(fds_[i], disable);
+    }
+    for (int i = 0; i < event_count; i++) {
+      if (fds_[i] >= 0) totals[i] += read_scaled(fds_[i]);
+    }
+  }
+
+ private:
+  perf_counters(const perf_counters&);
+  perf_counters& operator=(const perf_counters&);
+
+  enum request { reset, enable, disable };
+
+#ifdef __linux__
+  static int open_event(event e) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    switch (e) {
+      case cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case l1d_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cache_miss(PERF_COUNT_HW_CACHE_L1D);
+        break;
+      case llc_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cache_miss(PERF_COUNT_HW_CACHE_LL);
+        break;
+      case branch_misses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case dtlb_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cache_miss(PERF_COUNT_HW_CACHE_DTLB);
+        break;
+      default:
+        return -1;
+    }
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+
+  static unsigned long long cache_miss(unsigned long long cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  }
+
+  static void control(int fd, request r) {
+    switch (r) {
+      case reset:
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        break;
+      case enable:
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        break;
+      case disable:
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        break;
+    }
+  }
+
+  static double read_scaled(int fd) {
+    // value, time_enabled, time_running
+    unsigned long long data[3];
+    if (read(fd, data, sizeof(data)) != sizeof(data) || data[2] == 0) {
+      return 0;
+    }
+    return static_cast<double>(data[0]) * data[1] / data[2];
+  }
+#else
+  static int open_event(event) { return -1; }
+
+  static void control(int, request) {}
+
+  static double read_scaled(int) { return 0; }
+
+  static void close(int) {}
+#endif
+
+  int fds_[event_count];
+};
+
+}  // namespace bench
+
+#endif /* **************************************************** PERFCOUNTERS_H \
+        */
\ No newline at end of file
@@ -0,0 +1,280 @@
+#ifndef REPORT_HPP
+#define REPORT_HPP
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/utsname.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+struct stats {
+  double min;
+  double median;
+  double mean;
+  double stddev;
+  double p90;
+  double p99;
+  double max;
+};
+
+struct counter {
+  const char* name;
+  double per_op;
+  bool available;
+};
+
+// Everything known about one finished case.
+struct result {
+  std::string name;
+  std::string family;
+  size_t param;
+  bool sized;
+  size_t ops_per_iteration;
+  size_t iterations;
+  const char* clock;
+  stats summary;
+  double wall_median;
+  double cpu_median;
+  std::vector<double> samples;
+  std::vector<counter> counters;
+};
+
+typedef std::vector<std::pair<std::string, std::string> > context_type;
+
+// Writes results to stdout as they come in, in the format picked by
+// BENCH_FORMAT:
+//   tsv   (default) a header line, then one line per case
+//   csv   "# key,value" lines with the context, a header, one row per case
+//   json  {"context": {...}, "benchmarks": [...]} including the raw samples,
+//         for compare.py
+class reporter {
+ public:
+  enum format { tsv, csv, json };
+
+  static reporter& get() {
+    static reporter instance;
+    return instance;
+  }
+
+  ~reporter() {
+    if (format_ == json && started_) {
+      std::cout << "\n  ]\n}" << std::endl;
+    }
+  }
+
+  void add(const result& r) {
+    std::ios::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    std::cout << std::fixed << std::setprecision(2);
+    switch (format_) {
+      case tsv:
+        write_delimited(r, '\t');
+        break;
+      case csv:
+        write_delimited(r, ',');
+        break;
+      case json:
+        write_json(r);
+        break;
+    }
+    started_ = true;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+  }
+
+  // Build and machine description recorded with every JSON and CSV report.
+  static context_type context() {
+    context_type ctx;
+    char buf[256];
+    time_t t = time(NULL);
+    strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S%z", localtime(&t));
+    ctx.push_back(std::make_pair("date", std::string(buf)));
+    if (gethostname(buf, sizeof(buf)) == 0) {
+      buf[sizeof(buf) - 1] = '\0';
+      ctx.push_back(std::make_pair("host", std::string(buf)));
+    }
+    struct utsname uts;
+    if (uname(&uts) == 0) {
+      ctx.push_back(std::make_pair(
+          "os", std::string(uts.sysname) + " " + uts.release + " " +
+                    uts.machine));
+    }
+    ctx.push_back(std::make_pair("cpu", cpu_model()));
+    ctx.push_back(std::make_pair(
+        "cpus", to_string(static_cast<long>(sysconf(_SC_NPROCESSORS_ONLN)))));
+#if defined(__clang__)
+    ctx.push_back(std::make_pair("compiler", std::string(__VERSION__)));
+#elif defined(__GNUC__)
+    ctx.push_back(
+        std::make_pair("compiler", "gcc " + std::string(__VERSION__)));
+#endif
+    ctx.push_back(
+        std::make_pair("cplusplus", to_string(static_cast<long>(__cplusplus))));
+#ifdef __OPTIMIZE__
+    ctx.push_back(std::make_pair("optimized", std::string("yes")));
+#else
+    ctx.push_back(std::make_pair("optimized", std::string("no")));
+#endif
+#ifdef BENCH_FLAGS
+    ctx.push_back(std::make_pair("flags", std::string(BENCH_FLAGS)));
+#endif
+#ifdef BENCH_LIBRARY
+    ctx.push_back(std::make_pair("library", std::string(BENCH_LIBRARY)));
+#endif
+    const char* label = getenv("BENCH_LABEL");
+    if (label != NULL) {
+      ctx.push_back(std::make_pair("label", std::string(label)));
+    }
+    return ctx;
+  }
+
+ private:
+  reporter() : format_(tsv), started_(false) {
+    const char* f = getenv("BENCH_FORMAT");
+    if (f != NULL && std::string(f) == "csv") format_ = csv;
+    if (f != NULL && std::string(f) == "json") format_ = json;
+  }
+
+  reporter(const reporter&);
+  reporter& operator=(const reporter&);
+
+  void write_delimited(const result& r, char sep) {
+    if (!started_) {
+      if (format_ == csv) {
+        context_type ctx = context();
+        for (size_t i = 0; i < ctx.size(); i++) {
+          std::cout << "# " << ctx[i].first << sep << ctx[i].second << '\n';
+        }
+      }
+      std::cout << "name" << sep << "clock" << sep << "iterations" << sep
+                << "samples" << sep << "median_ns" << sep << "min_ns" << sep
+                << "mean_ns" << sep << "stddev_ns" << sep << "p90_ns" << sep
+                << "p99_ns" << sep << "max_ns" << sep << "wall_median_ns"
+                << sep << "cpu_median_ns";
+      for (size_t i = 0; i < r.counters.size(); i++) {
+        std::cout << sep << r.counters[i].name << "_per_op";
+      }
+      std::cout << '\n';
+    }
+    if (format_ == csv) {
+      std::cout << '"' << r.name << '"';
+    } else {
+      std::cout << r.name;
+    }
+    const stats& s = r.summary;
+    std::cout << sep << r.clock << sep << r.iterations << sep
+              << r.samples.size() << sep << s.median << sep << s.min << sep
+              << s.mean << sep << s.stddev << sep << s.p90 << sep << s.p99
+              << sep << s.max << sep << r.wall_median << sep << r.cpu_median;
+    for (size_t i = 0; i < r.counters.size(); i++) {
+      std::cout << sep;
+      if (r.counters[i].available) {
+        std::cout << r.counters[i].per_op;
+      } else {
+        std::cout << '-';
+      }
+    }
+    std::cout << std::endl;
+  }
+
+  void write_json(const result& r) {
+    if (!started_) {
+      std::cout << "{\n  \"context\": {";
+      context_type ctx = context();
+      for (size_t i = 0; i < ctx.size(); i++) {
+        std::cout << (i == 0 ? "\n" : ",\n") << "    " << quote(ctx[i].first)
+                  << ": " << quote(ctx[i].second);
+      }
+      std::cout << "\n  },\n  \"benchmarks\": [\n";
+    } else {
+      std::cout << ",\n";
+    }
+    const stats& s = r.summary;
+    std::cout << "    {\"name\": " << quote(r.name)
+              << ", \"family\": " << quote(r.family);
+    if (r.sized) std::cout << ", \"n\": " << r.param;
+    std::cout << ", \"ops_per_iteration\": " << r.ops_per_iteration
+              << ", \"iterations\": " << r.iterations
+              << ", \"clock\": " << quote(r.clock) << ",\n     \"median_ns\": "
+              << s.median << ", \"min_ns\": " << s.min
+              << ", \"mean_ns\": " << s.mean << ", \"stddev_ns\": " << s.stddev
+              << ", \"p90_ns\": " << s.p90 << ", \"p99_ns\": " << s.p99
+              << ", \"max_ns\": " << s.max
+              << ", \"wall_median_ns\": " << r.wall_median
+              << ", \"cpu_median_ns\": " << r.cpu_median;
+    if (!r.counters.empty()) {
+      std::cout << ",\n     \"counters\": {";
+      for (size_t i = 0; i < r.counters.size(); i++) {
+        std::cout << (i == 0 ? "" : ", ") << quote(r.counters[i].name)
+                  << ": ";
+        if (r.counters[i].available) {
+          std::cout << r.counters[i].per_op;
+        } else {
+          std::cout << "null";
+        }
+      }
+      std::cout << "}";
+    }
+    std::cout << ",\n     \"samples\": [";
+    for (size_t i = 0; i < r.samples.size(); i++) {
+      std::cout << (i == 0 ? "" : ", ") << r.samples[i];
+    }
+    std::cout << "]}" << std::flush;
+  }
+
+  static std::string quote(const std::string& s) {
+    std::string out = "\"";
+    for (size_t i = 0; i < s.size(); i++) {
+      unsigned char c = s[i];
+      if (c == '"' || c == '\\') {
+        out += '\\';
+        out += c;
+      } else if (c < 0x20) {
+        char buf[8];
+        snprintf(buf, sizeof(buf), "\\u%04x", c);
+        out += buf;
+      } else {
+        out += c;
+      }
+    }
+    return out + "\"";
+  }
+
+  static std::string to_string(long value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+  }
+
+  static std::string cpu_model() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+      if (line.compare(0, 10, "model name") == 0) {
+        size_t colon = line.find(':');
+        if (colon != std::string::npos && colon + 2 <= line.size()) {
+          return line.substr(colon + 2);
+        }
+      }
+    }
+    return "unknown";
+  }
+
+  format format_;
+  bool started_;
+};
+
+}  // namespace bench
+
+#endif /* ********************************************************** REPORT_H \
+        */
\ No newline at end of file
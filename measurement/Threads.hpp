@@ -0,0 +1,155 @@
+#ifndef THREADS_HPP
+#define THREADS_HPP
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "atomic.hpp"
+
+// Multithreaded throughput driver for the bench_*.cpp programs.
+//
+// A workload runs the same body on n threads, thread t pinned to CPU t. Each
+// thread prepares its own data first (so per-thread containers come from
+// that thread's allocator arena and its CPU's caches), then waits at the
+// start line. Once every thread is there the clock starts; after the run
+// time the stop flag goes up, and throughput is the sum of the operations
+// the threads report over the elapsed time.
+
+namespace bench {
+
+inline size_t online_cpus() {
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  return ncpu > 0 ? static_cast<size_t>(ncpu) : 1;
+}
+
+inline void pin_to_cpu(size_t cpu) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % online_cpus(), &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+// 1, 2, 4, ... and max itself, the points of a scalability curve.
+inline std::vector<size_t> thread_counts(size_t max) {
+  std::vector<size_t> counts;
+  for (size_t n = 1; n < max; n *= 2) {
+    counts.push_back(n);
+  }
+  counts.push_back(max);
+  return counts;
+}
+
+// Shared by the threads of one run.
+class start_line {
+ public:
+  start_line() : ready_(0), go_(0), stop_(0) {}
+
+  // Called by every worker once it is prepared; returns when the clock
+  // starts.
+  void wait() {
+    ft::atomic_fetch_add(&ready_, static_cast<size_t>(1));
+    ft::backoff wait;
+    while (ft::atomic_load_acquire(&go_) == 0) {
+      wait.pause();
+    }
+  }
+
+  // Polled by the workers between batches of operations.
+  bool stopped() const { return ft::atomic_load_relaxed(&stop_) != 0; }
+
+ private:
+  friend class team;
+
+  size_t ready_;
+  char pad0_[ft::cache_line_size - sizeof(size_t)];
+  int go_;
+  char pad1_[ft::cache_line_size - sizeof(int)];
+  int stop_;
+};
+
+class workload {
+ public:
+  virtual ~workload() {}
+
+  // Called on the main thread before a run with threads workers, e.g. to
+  // build the shared container.
+  virtual void setup(size_t threads) { (void)threads; }
+
+  // Body of worker thread: prepare, line.wait(), then work until
+  // line.stopped(). Returns the number of operations done after the start.
+  virtual size_t run(size_t thread, start_line& line) = 0;
+
+  // Called on the main thread after every worker returned.
+  virtual void teardown() {}
+};
+
+// Runs work on threads pinned threads for ms milliseconds and returns the
+// operations per second of all of them together.
+class team {
+ public:
+  static double run(workload& work, size_t threads, long ms) {
+    start_line line;
+    std::vector<worker> workers(threads);
+    std::vector<pthread_t> ids(threads);
+    work.setup(threads);
+    for (size_t t = 0; t < threads; t++) {
+      workers[t].work = &work;
+      workers[t].line = &line;
+      workers[t].thread = t;
+      workers[t].ops = 0;
+      pthread_create(&ids[t], NULL, entry, &workers[t]);
+    }
+    ft::backoff wait;
+    while (ft::atomic_load_acquire(&line.ready_) < threads) {
+      wait.pause();
+    }
+
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ft::atomic_store_release(&line.go_, 1);
+    struct timespec duration = {ms / 1000, (ms % 1000) * 1000000};
+    nanosleep(&duration, NULL);
+    ft::atomic_store_release(&line.stop_, 1);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    size_t ops = 0;
+    for (size_t t = 0; t < threads; t++) {
+      pthread_join(ids[t], NULL);
+      ops += workers[t].ops;
+    }
+    work.teardown();
+    double sec =
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    return ops / sec;
+  }
+
+ private:
+  struct worker {
+    workload* work;
+    start_line* line;
+    size_t thread;
+    size_t ops;
+    char pad[ft::cache_line_size];
+  };
+
+  static void* entry(void* p) {
+    worker* w = static_cast<worker*>(p);
+    pin_to_cpu(w->thread);
+    w->ops = w->work->run(w->thread, *w->line);
+    return NULL;
+  }
+};
+
+}  // namespace bench
+
+#endif /* ********************************************************* THREADS_H \
+        */
\ No newline at end of file
@@ -0,0 +1,195 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+// Operation streams for replaying a workload against a map.
+//
+// A trace is a sequence of finds, inserts and erases on keys in
+// [0, keyspace). It is either generated from a key pattern and an operation
+// mix, or read from a text file with one operation per line:
+//   f 42    find key 42
+//   i 42    insert key 42
+//   e 42    erase key 42
+// Keys are indices: the program turns them into the key type under test, so
+// one trace drives int, string and struct keyed maps alike.
+//
+// Patterns:
+//   uniform     every key equally likely
+//   zipf        Zipfian with theta 0.99 as in YCSB; the hot keys are spread
+//               over the key space instead of being neighbours
+//   sequential  0, 1, 2, ... wrapping around
+//   reverse     keyspace - 1, keyspace - 2, ... wrapping around
+//   sawtooth    ascending runs of 1024 keys, each from a random start
+
+namespace bench {
+
+enum trace_kind { trace_find, trace_insert, trace_erase };
+
+struct trace_op {
+  unsigned int key;
+  unsigned char kind;
+};
+
+// Percentages of finds, inserts and erases, written "80/10/10" and shown
+// as "f80 i10 e10".
+struct trace_mix {
+  unsigned int find;
+  unsigned int insert;
+  unsigned int erase;
+
+  static bool parse(const char* text, trace_mix& mix) {
+    unsigned int find;
+    unsigned int insert;
+    unsigned int erase;
+    char end;
+    if (sscanf(text, "%u/%u/%u%c", &find, &insert, &erase, &end) != 3 ||
+        find + insert + erase != 100) {
+      return false;
+    }
+    mix.find = find;
+    mix.insert = insert;
+    mix.erase = erase;
+    return true;
+  }
+
+  std::string str() const {
+    std::ostringstream out;
+    out << 'f' << find << " i" << insert << " e" << erase;
+    return out.str();
+  }
+};
+
+// Zipfian ranks in [0, n) following Gray et al., "Quickly generating
+// billion-record synthetic databases", the generator YCSB uses. Rank 0 is
+// the most frequent.
+class zipf {
+ public:
+  zipf(size_t n, double theta = 0.99)
+      : n_(n), theta_(theta), alpha_(1 / (1 - theta)), zetan_(zeta(n, theta)) {
+    eta_ = (1 - std::pow(2.0 / n, 1 - theta)) / (1 - zeta(2, theta) / zetan_);
+  }
+
+  size_t operator()(rng& gen) const {
+    double u = (gen.next() >> 11) * (1.0 / 9007199254740992.0);
+    double uz = u * zetan_;
+    if (uz < 1) return 0;
+    if (uz < 1 + std::pow(0.5, theta_)) return 1;
+    size_t rank =
+        static_cast<size_t>(n_ * std::pow(eta_ * u - eta_ + 1, alpha_));
+    return rank < n_ ? rank : n_ - 1;
+  }
+
+ private:
+  static double zeta(size_t n, double theta) {
+    double sum = 0;
+    for (size_t i = 1; i <= n; i++) {
+      sum += 1 / std::pow(static_cast<double>(i), theta);
+    }
+    return sum;
+  }
+
+  size_t n_;
+  double theta_;
+  double alpha_;
+  double zetan_;
+  double eta_;
+};
+
+inline const char* const* trace_patterns() {
+  static const char* const patterns[] = {"uniform", "zipf", "sequential",
+                                         "reverse", "sawtooth", NULL};
+  return patterns;
+}
+
+// count operations of pattern over keyspace keys. Returns an empty trace for
+// an unknown pattern.
+inline std::vector<trace_op> generate_trace(const std::string& pattern,
+                                            size_t keyspace, size_t count,
+                                            const trace_mix& mix,
+                                            unsigned long long seed = 1) {
+  static const size_t run = 1024;
+  std::vector<trace_op> trace;
+  const char* const* known = trace_patterns();
+  while (*known != NULL && pattern != *known) known++;
+  if (*known == NULL) return trace;
+  rng gen(seed);
+  std::vector<int> scatter;
+  if (pattern == "zipf") scatter = shuffled(keyspace, seed + 1);
+  const zipf ranks(pattern == "zipf" ? keyspace : 2);
+  size_t base = 0;
+  trace.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    size_t key;
+    if (pattern == "uniform") {
+      key = gen.below(keyspace);
+    } else if (pattern == "zipf") {
+      key = scatter[ranks(gen)];
+    } else if (pattern == "sequential") {
+      key = i % keyspace;
+    } else if (pattern == "reverse") {
+      key = keyspace - 1 - i % keyspace;
+    } else {
+      if (i % run == 0) base = gen.below(keyspace);
+      key = (base + i % run) % keyspace;
+    }
+    size_t dice = gen.below(100);
+    trace[i].key = static_cast<unsigned int>(key);
+    trace[i].kind = dice < mix.find                ? trace_find
+                    : dice < mix.find + mix.insert ? trace_insert
+                                                   : trace_erase;
+  }
+  return trace;
+}
+
+// Reads a trace file into trace and sets keyspace to the largest key + 1.
+// Returns false, with a message on stderr, if the file cannot be read or a
+// line is malformed.
+inline bool read_trace(const char* path, std::vector<trace_op>& trace,
+                       size_t& keyspace) {
+  FILE* file = fopen(path, "r");
+  if (file == NULL) {
+    perror(path);
+    return false;
+  }
+  trace.clear();
+  keyspace = 0;
+  char kind;
+  unsigned int key;
+  int fields;
+  while ((fields = fscanf(file, " %c %u", &kind, &key)) == 2) {
+    trace_op op;
+    op.key = key;
+    if (kind == 'f') {
+      op.kind = trace_find;
+    } else if (kind == 'i') {
+      op.kind = trace_insert;
+    } else if (kind == 'e') {
+      op.kind = trace_erase;
+    } else {
+      break;
+    }
+    trace.push_back(op);
+    if (key >= keyspace) keyspace = key + 1;
+  }
+  bool ok = fields == EOF && !trace.empty();
+  if (!ok) {
+    fprintf(stderr, "%s: bad trace line %lu\n", path,
+            static_cast<unsigned long>(trace.size() + 1));
+  }
+  fclose(file);
+  return ok;
+}
+
+}  // namespace bench
+
+#endif /* *********************************************************** TRACE_H \
+        */
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef TRACKINGALLOCATOR_HPP
+#define TRACKINGALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace bench {
+
+// Process-wide totals of every tracking_allocator, whatever its value type,
+// so the nodes a map allocates through a rebound allocator are counted too.
+// Not synchronized: meant for the single threaded measure programs.
+struct allocation_stats {
+  std::size_t allocations;
+  std::size_t deallocations;
+  std::size_t bytes_allocated;
+  std::size_t bytes_live;
+  std::size_t bytes_peak;
+
+  // Starts a new measurement. Memory that is still live stays counted, and
+  // the peak restarts from it.
+  void reset() {
+    allocations = 0;
+    deallocations = 0;
+    bytes_allocated = 0;
+    bytes_peak = bytes_live;
+  }
+};
+
+inline allocation_stats& allocation_counters() {
+  static allocation_stats stats = allocation_stats();
+  return stats;
+}
+
+// std::allocator replacement that records every request in
+// allocation_counters(). Usable as the Allocator parameter of the ft and std
+// containers.
+template <class T>
+class tracking_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <class U>
+  struct rebind {
+    typedef tracking_allocator<U> other;
+  };
+
+  tracking_allocator() throw() {}
+
+  tracking_allocator(const tracking_allocator&) throw() {}
+
+  template <class U>
+  tracking_allocator(const tracking_allocator<U>&) throw() {}
+
+  ~tracking_allocator() throw() {}
+
+  pointer address(reference x) const { return &x; }
+
+  const_pointer address(const_reference x) const { return &x; }
+
+  pointer allocate(size_type n, const void* = 0) {
+    pointer p = static_cast<pointer>(::operator new(n * sizeof(T)));
+    allocation_stats& stats = allocation_counters();
+    stats.allocations++;
+    stats.bytes_allocated += n * sizeof(T);
+    stats.bytes_live += n * sizeof(T);
+    if (stats.bytes_live > stats.bytes_peak) {
+      stats.bytes_peak = stats.bytes_live;
+    }
+    return p;
+  }
+
+  void deallocate(pointer p, size_type n) {
+    allocation_stats& stats = allocation_counters();
+    stats.deallocations++;
+    stats.bytes_live -= n * sizeof(T);
+    ::operator delete(p);
+  }
+
+  size_type max_size() const throw() {
+    return static_cast<size_type>(-1) / sizeof(T);
+  }
+
+  void construct(pointer p, const T& value) { new (p) T(value); }
+
+  void destroy(pointer p) { p->~T(); }
+};
+
+template <class T, class U>
+bool operator==(const tracking_allocator<T>&, const tracking_allocator<U>&) {
+  return true;
+}
+
+template <class T, class U>
+bool operator!=(const tracking_allocator<T>&, const tracking_allocator<U>&) {
+  return false;
+}
+
+}  // namespace bench
+
+#endif /* *********************************************** TRACKINGALLOCATOR_H \
+        */
\ No newline at end of file
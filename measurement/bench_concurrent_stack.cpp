@@ -0,0 +1,105 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include "concurrent_stack.hpp"
+#include "stack.hpp"
+
+// Push/pop throughput of ft::concurrent_stack against ft::stack behind a
+// pthread mutex, from 1 thread up to max_threads.
+//   clang++ -O2 -std=c++98 -I ../includes bench_concurrent_stack.cpp -lpthread
+//   ./a.out [ops per thread] [max threads]
+
+struct locked_stack {
+  pthread_mutex_t mutex;
+  ft::stack<size_t> stack;
+
+  locked_stack() { pthread_mutex_init(&mutex, NULL); }
+  ~locked_stack() { pthread_mutex_destroy(&mutex); }
+
+  void push(size_t value) {
+    pthread_mutex_lock(&mutex);
+    stack.push(value);
+    pthread_mutex_unlock(&mutex);
+  }
+
+  bool try_pop(size_t& out) {
+    pthread_mutex_lock(&mutex);
+    bool found = !stack.empty();
+    if (found) {
+      out = stack.top();
+      stack.pop();
+    }
+    pthread_mutex_unlock(&mutex);
+    return found;
+  }
+};
+
+template <class Stack>
+struct bench_arg {
+  Stack* stack;
+  size_t ops;
+  size_t checksum;
+};
+
+template <class Stack>
+static void* worker(void* p) {
+  bench_arg<Stack>* arg = static_cast<bench_arg<Stack>*>(p);
+  size_t value;
+  for (size_t i = 0; i < arg->ops; i++) {
+    arg->stack->push(i);
+    if (arg->stack->try_pop(value)) {
+      arg->checksum += value;
+    }
+  }
+  return NULL;
+}
+
+template <class Stack>
+static double run(size_t threads, size_t ops) {
+  Stack stack;
+  pthread_t* ids = new pthread_t[threads];
+  bench_arg<Stack>* args = new bench_arg<Stack>[threads];
+
+  struct timespec start;
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t t = 0; t < threads; t++) {
+    args[t].stack = &stack;
+    args[t].ops = ops;
+    args[t].checksum = 0;
+    pthread_create(&ids[t], NULL, worker<Stack>, &args[t]);
+  }
+  for (size_t t = 0; t < threads; t++) {
+    pthread_join(ids[t], NULL);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  delete[] ids;
+  delete[] args;
+  double sec =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  return 2 * threads * ops / sec;
+}
+
+int main(int argc, char** argv) {
+  size_t ops = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10)
+                                : static_cast<size_t>(ncpu > 0 ? ncpu : 1);
+
+  std::cout << "threads\tconcurrent_stack ops/s\tmutex stack ops/s"
+            << std::endl;
+  for (size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    std::cout << threads << "\t"
+              << static_cast<long>(
+                     run<ft::concurrent_stack<size_t> >(threads, ops))
+              << "\t" << static_cast<long>(run<locked_stack>(threads, ops))
+              << std::endl;
+    if (threads >= max_threads) break;
+  }
+}
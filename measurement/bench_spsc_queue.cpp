@@ -0,0 +1,140 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include "spsc_queue.hpp"
+
+// Throughput of ft::spsc_queue between a producer and a consumer pinned to
+// different CPUs.
+//   clang++ -O2 -std=c++98 -I ../includes bench_spsc_queue.cpp -lpthread
+//   ./a.out [messages] [batch]
+
+typedef ft::spsc_queue<size_t> queue_type;
+
+struct bench_arg {
+  queue_type* queue;
+  size_t messages;
+  size_t batch;
+  int cpu;
+  size_t checksum;
+};
+
+static void pin_to_cpu(int cpu) {
+#ifdef __linux__
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  if (ncpu <= 0) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % ncpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+static void* producer(void* p) {
+  bench_arg* arg = static_cast<bench_arg*>(p);
+  pin_to_cpu(arg->cpu);
+
+  size_t buf[256];
+  size_t sent = 0;
+  while (sent < arg->messages) {
+    if (arg->batch == 1) {
+      arg->queue->push(sent++);
+      continue;
+    }
+    size_t n = std::min(arg->batch, arg->messages - sent);
+    for (size_t i = 0; i < n; i++) {
+      buf[i] = sent + i;
+    }
+    size_t done = 0;
+    ft::backoff wait;
+    while (done < n) {
+      size_t pushed = arg->queue->try_push_n(buf + done, n - done);
+      if (pushed == 0) {
+        wait.pause();
+      } else {
+        wait.reset();
+      }
+      done += pushed;
+    }
+    sent += n;
+  }
+  return NULL;
+}
+
+static void* consumer(void* p) {
+  bench_arg* arg = static_cast<bench_arg*>(p);
+  pin_to_cpu(arg->cpu);
+
+  size_t buf[256];
+  size_t received = 0;
+  size_t checksum = 0;
+  ft::backoff wait;
+  while (received < arg->messages) {
+    if (arg->batch == 1) {
+      size_t value;
+      arg->queue->pop(value);
+      checksum += value;
+      received++;
+      continue;
+    }
+    size_t n = arg->queue->try_pop_n(buf, arg->batch);
+    if (n == 0) {
+      wait.pause();
+    } else {
+      wait.reset();
+    }
+    for (size_t i = 0; i < n; i++) {
+      checksum += buf[i];
+    }
+    received += n;
+  }
+  arg->checksum = checksum;
+  return NULL;
+}
+
+static double run(size_t messages, size_t batch) {
+  batch = std::min<size_t>(batch, 256);
+  queue_type queue(4096);
+  bench_arg prod = {&queue, messages, batch, 0, 0};
+  bench_arg cons = {&queue, messages, batch, 1, 0};
+
+  struct timespec start;
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  pthread_t threads[2];
+  pthread_create(&threads[0], NULL, consumer, &cons);
+  pthread_create(&threads[1], NULL, producer, &prod);
+  pthread_join(threads[1], NULL);
+  pthread_join(threads[0], NULL);
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  if (cons.checksum != messages * (messages - 1) / 2) {
+    std::cerr << "checksum mismatch" << std::endl;
+    exit(1);
+  }
+  double sec =
+      (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+  return messages / sec;
+}
+
+int main(int argc, char** argv) {
+  size_t messages = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+  size_t batch = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+
+  size_t batches[] = {1, 16, 64, 256};
+  for (size_t i = 0; i < sizeof(batches) / sizeof(batches[0]); i++) {
+    if (batch != 0 && batches[i] != batch) continue;
+    std::cout << "batch " << batches[i] << ": "
+              << static_cast<long>(run(messages, batches[i])) << " msg/s"
+              << std::endl;
+  }
+}
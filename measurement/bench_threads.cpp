@@ -0,0 +1,201 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Threads.hpp"
+#include "Trace.hpp"
+#include "concurrent_stack.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+// Scalability of container workloads from 1 thread up to max threads,
+// threads pinned one per CPU. Per-thread workloads share nothing but the
+// allocator, so a curve that flattens there is allocator contention, e.g.
+// from the allocate(1) of every map node; shared workloads add the cost of
+// the synchronization around the container.
+//   clang++ -O2 -std=c++98 -I ../includes bench_threads.cpp -lpthread
+//   ./a.out [ms per point] [find/insert/erase mix] [max threads]
+
+typedef ft::map<int, int> map_type;
+
+static const size_t keyspace = 1 << 16;
+static const size_t batch = 64;
+
+// Every thread replays its own uniform trace with the requested mix over
+// [0, keyspace); the map starts half full.
+static void prefill(map_type& map) {
+  const std::vector<int> keys = bench::shuffled(keyspace, 7);
+  for (size_t i = 0; i < keyspace / 2; i++) {
+    map.insert(ft::make_pair(keys[i], keys[i]));
+  }
+}
+
+static void apply(map_type& map, const bench::trace_op& op) {
+  int key = static_cast<int>(op.key);
+  if (op.kind == bench::trace_find) {
+    bench::do_not_optimize(map.find(key));
+  } else if (op.kind == bench::trace_insert) {
+    map.insert(ft::make_pair(key, key));
+  } else {
+    map.erase(key);
+  }
+}
+
+class map_workload : public bench::workload {
+ public:
+  explicit map_workload(const bench::trace_mix& mix) : mix_(mix) {}
+
+  void setup(size_t threads) {
+    traces_.clear();
+    for (size_t t = 0; t < threads; t++) {
+      traces_.push_back(
+          bench::generate_trace("uniform", keyspace, 1 << 16, mix_, t + 1));
+    }
+  }
+
+  void teardown() { traces_.clear(); }
+
+ protected:
+  bench::trace_mix mix_;
+  std::vector<std::vector<bench::trace_op> > traces_;
+};
+
+class private_map : public map_workload {
+ public:
+  explicit private_map(const bench::trace_mix& mix) : map_workload(mix) {}
+
+  size_t run(size_t thread, bench::start_line& line) {
+    const std::vector<bench::trace_op>& trace = traces_[thread];
+    map_type map;
+    prefill(map);
+    line.wait();
+    size_t ops = 0;
+    while (!line.stopped()) {
+      for (size_t i = 0; i < batch; i++) {
+        apply(map, trace[(ops + i) & (trace.size() - 1)]);
+      }
+      ops += batch;
+    }
+    return ops;
+  }
+};
+
+class locked_map : public map_workload {
+ public:
+  explicit locked_map(const bench::trace_mix& mix) : map_workload(mix) {
+    pthread_mutex_init(&mutex_, NULL);
+  }
+
+  ~locked_map() { pthread_mutex_destroy(&mutex_); }
+
+  void setup(size_t threads) {
+    map_workload::setup(threads);
+    map_.clear();
+    prefill(map_);
+  }
+
+  size_t run(size_t thread, bench::start_line& line) {
+    const std::vector<bench::trace_op>& trace = traces_[thread];
+    line.wait();
+    size_t ops = 0;
+    while (!line.stopped()) {
+      for (size_t i = 0; i < batch; i++) {
+        pthread_mutex_lock(&mutex_);
+        apply(map_, trace[(ops + i) & (trace.size() - 1)]);
+        pthread_mutex_unlock(&mutex_);
+      }
+      ops += batch;
+    }
+    return ops;
+  }
+
+ private:
+  pthread_mutex_t mutex_;
+  map_type map_;
+};
+
+// Builds and drops a 1000 element vector per operation: nothing but
+// allocator traffic on the growing buffers.
+class private_vector : public bench::workload {
+ public:
+  size_t run(size_t, bench::start_line& line) {
+    line.wait();
+    size_t ops = 0;
+    while (!line.stopped()) {
+      ft::vector<int> vec;
+      for (int i = 0; i < 1000; i++) {
+        vec.push_back(i);
+      }
+      bench::do_not_optimize(vec);
+      ops++;
+    }
+    return ops;
+  }
+};
+
+// A push and a pop on one ft::concurrent_stack count as two operations.
+class shared_stack : public bench::workload {
+ public:
+  size_t run(size_t, bench::start_line& line) {
+    line.wait();
+    size_t ops = 0;
+    size_t value;
+    while (!line.stopped()) {
+      for (size_t i = 0; i < batch; i++) {
+        stack_.push(i);
+        stack_.try_pop(value);
+      }
+      ops += 2 * batch;
+    }
+    return ops;
+  }
+
+ private:
+  ft::concurrent_stack<size_t> stack_;
+};
+
+static void curve(const std::string& name, bench::workload& work,
+                  const std::vector<size_t>& counts, long ms) {
+  double single = 0;
+  for (size_t i = 0; i < counts.size(); i++) {
+    double ops = bench::team::run(work, counts[i], ms);
+    if (i == 0) single = ops / counts[0];
+    double speedup = single > 0 ? ops / single : 0;
+    std::cout << name << '\t' << counts[i] << '\t'
+              << static_cast<long>(ops) << '\t' << speedup << '\t'
+              << speedup / counts[i] << std::endl;
+  }
+}
+
+int main(int argc, char** argv) {
+  long ms = argc > 1 ? strtol(argv[1], NULL, 10) : 200;
+  bench::trace_mix mix = {80, 10, 10};
+  if (argc > 2 && !bench::trace_mix::parse(argv[2], mix)) {
+    std::cerr << "mix: expected find/insert/erase percentages adding up to "
+                 "100, got "
+              << argv[2] << std::endl;
+    return 1;
+  }
+  size_t max_threads =
+      argc > 3 ? strtoul(argv[3], NULL, 10) : bench::online_cpus();
+  if (ms <= 0 || max_threads == 0) {
+    std::cerr << "usage: " << argv[0]
+              << " [ms per point] [find/insert/erase mix] [max threads]"
+              << std::endl;
+    return 1;
+  }
+  const std::vector<size_t> counts = bench::thread_counts(max_threads);
+
+  std::cout << "name\tthreads\tops_per_sec\tspeedup\tefficiency" << std::endl;
+  private_map per_thread(mix);
+  curve("map per thread " + mix.str(), per_thread, counts, ms);
+  locked_map shared(mix);
+  curve("map shared mutex " + mix.str(), shared, counts, ms);
+  private_vector vectors;
+  curve("vector per thread build 1000", vectors, counts, ms);
+  shared_stack stack;
+  curve("concurrent_stack shared push pop", stack, counts, ms);
+}
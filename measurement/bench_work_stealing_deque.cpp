@@ -0,0 +1,152 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "work_stealing_deque.hpp"
+
+// Fork-join parallel sum over an array scheduled with one
+// ft::work_stealing_deque per worker. A task is a [lo, hi) range packed into
+// one word; a worker splits its task in halves, pushes the upper half for
+// thieves and keeps the lower half until it is below the cutoff.
+//   clang++ -O2 -std=c++98 -I ../includes bench_work_stealing_deque.cpp
+//     -lpthread
+//   ./a.out [elements] [max threads]
+
+typedef unsigned long task_type;
+typedef ft::work_stealing_deque<task_type> deque_type;
+
+static const unsigned long cutoff = 4096;
+
+struct scheduler {
+  const unsigned int* data;
+  unsigned long elements;
+  std::vector<deque_type*> deques;
+  unsigned long done;
+  unsigned long sum;
+};
+
+struct worker_arg {
+  scheduler* sched;
+  size_t id;
+};
+
+static task_type make_task(unsigned long lo, unsigned long hi) {
+  return (lo << 32) | hi;
+}
+
+static void run_task(scheduler* sched, deque_type* own, task_type task) {
+  unsigned long lo = task >> 32;
+  unsigned long hi = task & 0xffffffffUL;
+  while (hi - lo > cutoff) {
+    unsigned long mid = lo + (hi - lo) / 2;
+    own->push(make_task(mid, hi));
+    hi = mid;
+  }
+  unsigned long sum = 0;
+  for (unsigned long i = lo; i < hi; i++) {
+    sum += sched->data[i];
+  }
+  ft::atomic_fetch_add(&sched->sum, sum);
+  ft::atomic_fetch_add(&sched->done, hi - lo);
+}
+
+static void* worker(void* p) {
+  worker_arg* arg = static_cast<worker_arg*>(p);
+  scheduler* sched = arg->sched;
+  deque_type* own = sched->deques[arg->id];
+  size_t workers = sched->deques.size();
+  unsigned long seed = arg->id * 2654435761UL + 1;
+  ft::backoff wait;
+
+  while (ft::atomic_load_acquire(&sched->done) < sched->elements) {
+    task_type task;
+    bool found = own->pop(task);
+    for (size_t i = 0; !found && i < workers; i++) {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      size_t victim = seed % workers;
+      if (victim != arg->id) {
+        found = sched->deques[victim]->steal(task);
+      }
+    }
+    if (found) {
+      run_task(sched, own, task);
+      wait.reset();
+    } else {
+      wait.pause();
+    }
+  }
+  return NULL;
+}
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double run(const std::vector<unsigned int>& data, size_t threads,
+                  unsigned long expected) {
+  scheduler sched;
+  sched.data = &data[0];
+  sched.elements = data.size();
+  sched.done = 0;
+  sched.sum = 0;
+  for (size_t t = 0; t < threads; t++) {
+    sched.deques.push_back(new deque_type());
+  }
+  sched.deques[0]->push(make_task(0, data.size()));
+
+  std::vector<pthread_t> ids(threads);
+  std::vector<worker_arg> args(threads);
+  double start = now();
+  for (size_t t = 0; t < threads; t++) {
+    args[t].sched = &sched;
+    args[t].id = t;
+    pthread_create(&ids[t], NULL, worker, &args[t]);
+  }
+  for (size_t t = 0; t < threads; t++) {
+    pthread_join(ids[t], NULL);
+  }
+  double elapsed = now() - start;
+
+  for (size_t t = 0; t < threads; t++) {
+    delete sched.deques[t];
+  }
+  if (sched.sum != expected) {
+    std::cerr << "sum mismatch" << std::endl;
+    exit(1);
+  }
+  return elapsed;
+}
+
+int main(int argc, char** argv) {
+  unsigned long elements = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000000;
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10)
+                                : static_cast<size_t>(ncpu > 0 ? ncpu : 1);
+  elements = std::min(elements, 0xffffffffUL);
+
+  std::vector<unsigned int> data(elements);
+  unsigned long expected = 0;
+  for (unsigned long i = 0; i < elements; i++) {
+    data[i] = static_cast<unsigned int>(i % 1000);
+    expected += data[i];
+  }
+
+  std::cout << "threads\tms\tspeedup" << std::endl;
+  double base = 0;
+  for (size_t threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    double elapsed = run(data, threads, expected);
+    if (threads == 1) base = elapsed;
+    std::cout << threads << "\t" << elapsed * 1000 << "\t" << base / elapsed
+              << std::endl;
+    if (threads >= max_threads) break;
+  }
+}
@@ -0,0 +1,108 @@
+"""Compare two JSON benchmark reports (BENCH_FORMAT=json).
+
+    python3 compare.py baseline.json current.json [--threshold 5] [--alpha 0.01]
+
+A case is a regression when its median got slower by more than threshold
+percent and a two-sided Mann-Whitney U test on the samples says the
+difference is significant at level alpha. Both conditions are needed: the
+threshold ignores changes too small to matter, the test ignores changes the
+noise can explain. Exits with 1 if any case regressed, so it can gate a
+merge.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+green = '\033[32m'
+red = '\033[31m'
+yellow = '\033[33m'
+reset = '\033[0m'
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    cases = {case['name']: case for case in report['benchmarks']}
+    return report.get('context', {}), cases
+
+
+def mann_whitney_p(a, b):
+    """Two-sided p-value of the Mann-Whitney U test, normal approximation
+    with tie correction. Good enough from about 8 samples per side."""
+    n1, n2 = len(a), len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    values = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(values)
+    ties = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+    r1 = sum(r for r, (_, side) in zip(ranks, values) if side == 0)
+    u = r1 - n1 * (n1 + 1) / 2
+    n = n1 + n2
+    mean = n1 * n2 / 2
+    var = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(var)
+    return min(1.0, math.erfc(max(z, 0) / math.sqrt(2)))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='minimum slowdown in percent (default 5)')
+    parser.add_argument('--alpha', type=float, default=0.01,
+                        help='significance level (default 0.01)')
+    args = parser.parse_args()
+
+    base_ctx, base = load(args.baseline)
+    cur_ctx, cur = load(args.current)
+
+    for key in ('cpu', 'compiler', 'library', 'optimized', 'flags'):
+        if base_ctx.get(key) != cur_ctx.get(key):
+            print(f'{yellow}warning{reset}: {key} differs: '
+                  f'{base_ctx.get(key)} -> {cur_ctx.get(key)}')
+
+    regressions = 0
+    for name, case in cur.items():
+        if name not in base:
+            print(f'  new : {name}')
+            continue
+        old = base[name]
+        change = case['median_ns'] / old['median_ns'] - 1 \
+            if old['median_ns'] > 0 else 0.0
+        p = mann_whitney_p(old['samples'], case['samples'])
+        significant = p < args.alpha
+        if significant and change * 100 > args.threshold:
+            status = red + 'SLOWER' + reset
+            regressions += 1
+        elif significant and -change * 100 > args.threshold:
+            status = green + 'FASTER' + reset
+        else:
+            status = '  same'
+        print(f'{status} : {name} {old["median_ns"]:.2f} -> '
+              f'{case["median_ns"]:.2f} ns ({change * 100:+.1f}%, p={p:.3f})')
+    for name in base:
+        if name not in cur:
+            print(f'  gone : {name}')
+
+    if regressions:
+        print(f'{red}{regressions} regression(s){reset}')
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
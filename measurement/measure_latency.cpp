@@ -0,0 +1,102 @@
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Histogram.hpp"
+#include "Measurement.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+// Latency of single operations. Every operation of a case is timed on its
+// own with bench::op_timer and recorded in a bench::histogram, so the rare
+// slow ones stay visible: the copies when vector::push_back reallocates, the
+// deep rebalancing of some map inserts and erases. Averages smear those
+// over millions of cheap operations; p99.9 and max do not.
+// Columns are in ns; the first pass of every case is a warmup.
+
+typedef TEST::vector<int> t_vector;
+typedef TEST::map<int, int> t_map;
+
+static bool selected(const std::string& name) {
+  const char* filter = bench::options::get().filter;
+  return filter == NULL || name.find(filter) != std::string::npos;
+}
+
+static void print(const std::string& name, const bench::histogram& h) {
+  std::cout << name << '\t' << h.percentile(50) << '\t' << h.percentile(99)
+            << '\t' << h.percentile(99.9) << '\t' << h.max() << '\t'
+            << h.mean() << '\t' << h.count() << std::endl;
+}
+
+static void push_back(size_t n, bench::histogram& h) {
+  const bench::op_timer& timer = bench::op_timer::get();
+  t_vector vec;
+  for (size_t i = 0; i < n; i++) {
+    unsigned long long start = bench::op_timer::ticks();
+    vec.push_back(i);
+    unsigned long long end = bench::op_timer::ticks();
+    h.record(timer.ns(start, end));
+  }
+  bench::do_not_optimize(vec);
+}
+
+// insert, find and erase share one map: keys go in in random order, are
+// looked up at random and leave in another random order.
+static void map_ops(size_t n, bench::histogram& insert,
+                    bench::histogram& find, bench::histogram& erase) {
+  const bench::op_timer& timer = bench::op_timer::get();
+  const std::vector<int> in = bench::shuffled(n, 1);
+  const std::vector<int> out = bench::shuffled(n, 2);
+  const std::vector<unsigned int> probe = bench::random_indices(n, n, 3);
+  t_map map;
+  for (size_t i = 0; i < n; i++) {
+    unsigned long long start = bench::op_timer::ticks();
+    map.insert(TEST::make_pair(in[i], in[i]));
+    unsigned long long end = bench::op_timer::ticks();
+    insert.record(timer.ns(start, end));
+  }
+  for (size_t i = 0; i < n; i++) {
+    unsigned long long start = bench::op_timer::ticks();
+    t_map::iterator it = map.find(probe[i]);
+    bench::do_not_optimize(it);
+    unsigned long long end = bench::op_timer::ticks();
+    find.record(timer.ns(start, end));
+  }
+  for (size_t i = 0; i < n; i++) {
+    unsigned long long start = bench::op_timer::ticks();
+    map.erase(out[i]);
+    unsigned long long end = bench::op_timer::ticks();
+    erase.record(timer.ns(start, end));
+  }
+}
+
+int main() {
+  const size_t n = bench::options::get().latency_ops;
+  const bench::op_timer& timer = bench::op_timer::get();
+  std::cerr << "timer " << timer.source() << ", overhead "
+            << timer.overhead_ns() << " ns subtracted" << std::endl;
+
+  std::cout << "name\tp50_ns\tp99_ns\tp999_ns\tmax_ns\tmean_ns\tcount"
+            << std::endl;
+  if (selected("vector push_back")) {
+    bench::histogram h;
+    push_back(n, h);
+    h.reset();
+    push_back(n, h);
+    print("vector push_back", h);
+  }
+  if (selected("map")) {
+    bench::histogram insert;
+    bench::histogram find;
+    bench::histogram erase;
+    map_ops(n, insert, find, erase);
+    insert.reset();
+    find.reset();
+    erase.reset();
+    map_ops(n, insert, find, erase);
+    print("map insert", insert);
+    print("map find", find);
+    print("map erase", erase);
+  }
+}
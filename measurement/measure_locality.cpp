@@ -0,0 +1,93 @@
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Measurement.hpp"
+#include "map.hpp"
+
+// Traversal speed of maps holding the same keys but with their nodes laid
+// out differently in memory, in ns per visited element. Iteration follows
+// child and parent pointers, so its speed depends on where the allocator put
+// the nodes, which depends on the insertion history:
+//   sequential  keys inserted in ascending order: nodes sit in key order,
+//               back to back
+//   random      keys inserted in random order: neighbours in key order are
+//               scattered over the whole node area
+//   fragmented  ascending order, but every insert is preceded by a filler
+//               allocation of 16 to 512 bytes that is freed afterwards: key
+//               order is kept, the nodes are spread out with holes between
+// A full scan visits every element from begin() to end(); a range scan
+// visits up to 100 elements from lower_bound() of a random key.
+
+typedef TEST::map<int, int> t_map;
+
+static const size_t probes = 1 << 16;
+static const size_t range = 100;
+
+static void build_sequential(t_map& map, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    map.insert(TEST::make_pair(static_cast<int>(i), static_cast<int>(i)));
+  }
+}
+
+static void build_random(t_map& map, size_t n) {
+  const std::vector<int> keys = bench::shuffled(n);
+  for (size_t i = 0; i < n; i++) {
+    map.insert(TEST::make_pair(keys[i], keys[i]));
+  }
+}
+
+static void build_fragmented(t_map& map, size_t n) {
+  bench::rng gen;
+  std::vector<void*> fillers(n);
+  for (size_t i = 0; i < n; i++) {
+    fillers[i] = ::operator new(16 + gen.below(497));
+    map.insert(TEST::make_pair(static_cast<int>(i), static_cast<int>(i)));
+  }
+  for (size_t i = 0; i < n; i++) {
+    ::operator delete(fillers[i]);
+  }
+}
+
+static long full_scan(const t_map& map) {
+  long sum = 0;
+  for (t_map::const_iterator it = map.begin(); it != map.end(); ++it) {
+    sum += it->second;
+  }
+  return sum;
+}
+
+static long range_scan(const t_map& map, int from) {
+  long sum = 0;
+  t_map::const_iterator it = map.lower_bound(from);
+  for (size_t i = 0; i < range && it != map.end(); i++, ++it) {
+    sum += it->second;
+  }
+  return sum;
+}
+
+int main() {
+  static const char* const layouts[] = {"sequential", "random", "fragmented"};
+  static void (*const builders[])(t_map&, size_t) = {
+      build_sequential, build_random, build_fragmented};
+  const size_t max = bench::options::get().sweep_max;
+
+  for (size_t n = 1000; n <= max; n *= 10) {
+    // Start keys leave room for a whole range, so every scan visits range
+    // elements.
+    const std::vector<unsigned int> from =
+        bench::random_indices(n > range ? n - range : 1, probes);
+    for (size_t l = 0; l < sizeof(layouts) / sizeof(*layouts); l++) {
+      t_map map;
+      builders[l](map, n);
+      const std::string layout = layouts[l];
+      BENCH_SIZED(("map full scan " + layout).c_str(), n, n,
+                  bench::do_not_optimize(full_scan(map)));
+      BENCH_SIZED(("map range scan " + layout).c_str(), n, range,
+                  bench::do_not_optimize(
+                      range_scan(map, from[BENCH_I & (probes - 1)])));
+    }
+    if (n > max / 10) break;
+  }
+}
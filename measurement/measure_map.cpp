@@ -7,238 +7,103 @@
 typedef TEST::map<int, std::string> t_map;
 typedef TEST::pair<int, std::string> pair;
 
+static t_map make_map(size_t n) {
+  t_map map;
+  for (size_t i = 0; i < n; i++) {
+    map.insert(map.end(), pair(i, "hello"));
+  }
+  return map;
+}
+
 int main() {
   std::list<pair> lst;
   for (size_t i = 0; i < 10001; i++) {
     lst.push_back(TEST::make_pair(i, "hello"));
   }
 
-  {
-    // TEST: Constructor Default
-    MEASUREMENT(LOOP(t_map map));
-  }
-
-  {
-    // TEST: Constructor Range
-    MEASUREMENT(t_map map(lst.begin(), lst.end()));
-  }
-
-  {
-    // TEST: Constructor Copy
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(t_map map_cp(map));
-  }
-
-  {
-    // TEST: Operator=
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(t_map map_cp = map);
-  }
-
-  {
-    // TEST: begin()
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.begin()));
-  }
-
-  {
-    // TEST: begin() const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.begin()));
-  }
-
-  {
-    // TEST: end()
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.end()));
-  }
+  BENCH("Constructor Default", t_map map; bench::do_not_optimize(map));
 
-  {
-    // TEST: end() const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.end()));
-  }
+  BENCH("Constructor Range", t_map map(lst.begin(), lst.end());
+        bench::do_not_optimize(map));
 
   {
-    // TEST: rbegin()
     t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.rbegin()));
+    BENCH("Constructor Copy", t_map map_cp(map);
+          bench::do_not_optimize(map_cp));
+    BENCH("Operator=", t_map map_cp = map; bench::do_not_optimize(map_cp));
   }
 
   {
-    // TEST: rbegin() const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.rbegin()));
-  }
-
-  {
-    // TEST: rend()
     t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.rend()));
+    const t_map& cmap = map;
+    BENCH("begin()", bench::do_not_optimize(map.begin()));
+    BENCH("begin() const", bench::do_not_optimize(cmap.begin()));
+    BENCH("end()", bench::do_not_optimize(map.end()));
+    BENCH("end() const", bench::do_not_optimize(cmap.end()));
+    BENCH("rbegin()", bench::do_not_optimize(map.rbegin()));
+    BENCH("rbegin() const", bench::do_not_optimize(cmap.rbegin()));
+    BENCH("rend()", bench::do_not_optimize(map.rend()));
+    BENCH("rend() const", bench::do_not_optimize(cmap.rend()));
   }
 
   {
-    // TEST: rend() const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.rend()));
-  }
-
-  {
-    // TEST: empty true
     t_map map;
-    MEASUREMENT(LOOP(map.empty()));
-  }
-
-  {
-    // TEST: empty false
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.empty()));
-  }
-
-  {
-    // TEST: size
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.size()));
+    BENCH("empty true", bench::do_not_optimize(map.empty()));
   }
 
   {
-    // TEST: max_size
     t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.max_size()));
+    BENCH("empty false", bench::do_not_optimize(map.empty()));
+    BENCH("size", bench::do_not_optimize(map.size()));
+    BENCH("max_size", bench::do_not_optimize(map.max_size()));
+    BENCH("operator[]", bench::do_not_optimize(map[BENCH_I % 10000]));
   }
 
-  {
-    // TEST: operator[]
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map[i]; });
-  }
-
-  {
-    // TEST: insert value
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000;
-                     i++) { map.insert(pair(i + 1000, "hello")); });
-  }
+  BENCH_SETUP("insert value", t_map map,
+              bench::do_not_optimize(map.insert(pair(BENCH_I, "hello"))));
 
-  {
-    // TEST: insert Position val
-    t_map map;
-    MEASUREMENT(for (size_t i = 0; i < 10000;
-                     i++) { map.insert(map.begin(), pair(i, "hello")); });
-  }
+  BENCH_SETUP("insert Position val", t_map map,
+              map.insert(map.begin(), pair(BENCH_I, "hello")));
 
-  {
-    // TEST: insert Range
-    t_map map;
-    MEASUREMENT(map.insert(lst.begin(), lst.end()));
-  }
+  BENCH_EACH("insert Range", t_map map, map.insert(lst.begin(), lst.end()));
 
-  {
-    // TEST: erase position
-    t_map map(lst.begin(), lst.end());
-    for (size_t i = 0; i < 100; i++) {
-      map.insert(pair(i + 10000, "hello"));
-    }
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.erase(map.begin()); });
-  }
+  BENCH_SETUP("erase position", t_map map = make_map(BENCH_N),
+              map.erase(map.begin()));
 
-  {
-    // TEST: erase key
-    t_map map(lst.begin(), lst.end());
-    for (size_t i = 0; i < 100; i++) {
-      map.insert(pair(i + 10000, "hello"));
-    }
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.erase(i); });
-  }
+  BENCH_SETUP("erase key", t_map map = make_map(BENCH_N),
+              bench::do_not_optimize(map.erase(BENCH_I)));
 
-  {
-    // TEST: erase range
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(map.erase(map.begin(), map.end()););
-  }
+  BENCH_EACH("erase range", t_map map(lst.begin(), lst.end()),
+             map.erase(map.begin(), map.end()));
 
   {
-    // TEST: swap
     t_map map(lst.begin(), lst.end());
     t_map map2(lst.begin(), lst.end());
-    map.swap(map2);
-  }
-
-  {
-    // TEST: clear
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(map.clear());
-  }
-
-  {
-    // TEST: key_comp
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.key_comp()));
-  }
-
-  {
-    // TEST: value_comp
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.value_comp()));
-  }
-
-  {
-    // TEST: find
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.find(i); });
-  }
-
-  {
-    // TEST: find const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.find(i); });
-  }
-
-  {
-    // TEST: count
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.count(i); });
-  }
-
-  {
-    // TEST: lower_bound
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.lower_bound(i); });
-  }
-
-  {
-    // TEST: lower_bound const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.lower_bound(i); });
-  }
-
-  {
-    // TEST: upper_bound
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.upper_bound(i); });
-  }
-
-  {
-    // TEST: upper_bound const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.upper_bound(i); });
-  }
-
-  {
-    // TEST: equal_range
-    t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.equal_range(i); });
-  }
-
-  {
-    // TEST: equal_range const
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { map.equal_range(i); });
-  }
-
-  {
-    // TEST: get_allocator
-    const t_map map(lst.begin(), lst.end());
-    MEASUREMENT(LOOP(map.get_allocator()));
-  }
-}
\ No newline at end of file
+    BENCH("swap", map.swap(map2); bench::do_not_optimize(map));
+  }
+
+  BENCH_EACH("clear", t_map map(lst.begin(), lst.end()), map.clear());
+
+  {
+    t_map map(lst.begin(), lst.end());
+    const t_map& cmap = map;
+    BENCH("key_comp", bench::do_not_optimize(map.key_comp()));
+    BENCH("value_comp", bench::do_not_optimize(map.value_comp()));
+    BENCH("find", bench::do_not_optimize(map.find(BENCH_I % 10000)));
+    BENCH("find const", bench::do_not_optimize(cmap.find(BENCH_I % 10000)));
+    BENCH("count", bench::do_not_optimize(map.count(BENCH_I % 10000)));
+    BENCH("lower_bound",
+          bench::do_not_optimize(map.lower_bound(BENCH_I % 10000)));
+    BENCH("lower_bound const",
+          bench::do_not_optimize(cmap.lower_bound(BENCH_I % 10000)));
+    BENCH("upper_bound",
+          bench::do_not_optimize(map.upper_bound(BENCH_I % 10000)));
+    BENCH("upper_bound const",
+          bench::do_not_optimize(cmap.upper_bound(BENCH_I % 10000)));
+    BENCH("equal_range",
+          bench::do_not_optimize(map.equal_range(BENCH_I % 10000)));
+    BENCH("equal_range const",
+          bench::do_not_optimize(cmap.equal_range(BENCH_I % 10000)));
+    BENCH("get_allocator", bench::do_not_optimize(cmap.get_allocator()));
+  }
+}
@@ -0,0 +1,118 @@
+#include <deque>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <stack>
+#include <vector>
+
+#include "Measurement.hpp"
+#include "TrackingAllocator.hpp"
+#include "deque.hpp"
+#include "map.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+// Allocator traffic and footprint of each container, counted by
+// bench::tracking_allocator. For every case a container is prepared, then
+// run() performs n operations on it:
+//   bytes_per_element  bytes held by the container afterwards / size()
+//   peak_per_element   most bytes held at any time / size()
+//   allocs_per_op      allocations made by run() divided by n
+//   leaked_bytes       bytes still allocated after the container is gone
+
+typedef bench::tracking_allocator<int> t_alloc;
+typedef TEST::vector<int, t_alloc> t_vector;
+typedef TEST::deque<int, t_alloc> t_deque;
+typedef TEST::stack<int, t_vector> t_stack;
+typedef bench::tracking_allocator<TEST::pair<const int, int> > t_map_alloc;
+typedef TEST::map<int, int, std::less<int>, t_map_alloc> t_map;
+#ifdef STD
+typedef std::queue<int, t_deque> t_queue;
+#else
+typedef ft::queue<int, ft::ring_buffer<int, t_alloc> > t_queue;
+#endif
+
+template <class Container>
+static void nothing(Container&, size_t) {}
+
+template <class Container>
+static void push_back(Container& c, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    c.push_back(i);
+  }
+}
+
+template <class Container>
+static void reserve_push_back(Container& c, size_t n) {
+  c.reserve(n);
+  push_back(c, n);
+}
+
+template <class Container>
+static void push(Container& c, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    c.push(i);
+  }
+}
+
+static void insert(t_map& map, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    map.insert(TEST::make_pair(static_cast<int>(i), static_cast<int>(i)));
+  }
+}
+
+// Erases and reinserts every key once; the size stays n.
+static void erase_insert(t_map& map, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    map.erase(i);
+    map.insert(TEST::make_pair(static_cast<int>(i), static_cast<int>(i)));
+  }
+}
+
+template <class Container>
+static void measure(const char* name, size_t n,
+                    void (*prepare)(Container&, size_t),
+                    void (*run)(Container&, size_t)) {
+  bench::allocation_stats& stats = bench::allocation_counters();
+  size_t base = stats.bytes_live;
+  size_t allocations;
+  size_t live;
+  size_t peak;
+  size_t size;
+  {
+    Container c;
+    prepare(c, n);
+    stats.reset();
+    run(c, n);
+    allocations = stats.allocations;
+    live = stats.bytes_live - base;
+    peak = stats.bytes_peak - base;
+    size = c.size();
+  }
+  size_t leaked = stats.bytes_live - base;
+  double elements = size > 0 ? size : 1;
+  std::cout << name << '/' << n << '\t' << live / elements << '\t'
+            << peak / elements << '\t'
+            << static_cast<double>(allocations) / n << '\t' << leaked
+            << std::endl;
+}
+
+int main() {
+  static const size_t sizes[] = {10, 1000, 100000};
+
+  std::cout << "name\tbytes_per_element\tpeak_per_element\tallocs_per_op\t"
+               "leaked_bytes"
+            << std::endl;
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+    size_t n = sizes[s];
+    measure<t_vector>("vector push_back", n, nothing, push_back);
+    measure<t_vector>("vector reserve push_back", n, nothing,
+                      reserve_push_back);
+    measure<t_deque>("deque push_back", n, nothing, push_back);
+    measure<t_stack>("stack push", n, nothing, push);
+    measure<t_queue>("queue push", n, nothing, push);
+    measure<t_map>("map insert", n, nothing, insert);
+    measure<t_map>("map erase insert", n, insert, erase_insert);
+  }
+}
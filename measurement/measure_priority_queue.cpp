@@ -0,0 +1,35 @@
+#include <cstdlib>
+#include <queue>
+
+#include "Measurement.hpp"
+#include "priority_queue.hpp"
+
+typedef TEST::priority_queue<int> t_queue;
+
+int main() {
+  std::vector<int> keys;
+  for (size_t i = 0; i < 1000000; i++) {
+    keys.push_back(std::rand());
+  }
+
+  BENCH("Constructor Range int 10^6", t_queue queue(keys.begin(), keys.end());
+        bench::do_not_optimize(queue));
+
+  BENCH_EACH("push() int 10^6", t_queue queue,
+             for (size_t i = 0; i < keys.size(); i++) { queue.push(keys[i]); });
+
+  BENCH_EACH("pop() int 10^6", t_queue queue(keys.begin(), keys.end()),
+             while (!queue.empty()) { queue.pop(); });
+
+  BENCH_EACH("push() pop() std::string 10^5",
+             TEST::priority_queue<std::string> queue,
+             for (size_t i = 0; i < 100000; i++) {
+               queue.push(std::string(keys[i] % 32, 'a'));
+               if (i % 2 == 1) queue.pop();
+             });
+
+  {
+    t_queue queue(keys.begin(), keys.begin() + 1000);
+    BENCH("top()", bench::do_not_optimize(queue.top()));
+  }
+}
@@ -0,0 +1,46 @@
+#include <queue>
+
+#include "Measurement.hpp"
+#include "queue.hpp"
+
+typedef TEST::queue<std::string> t_queue;
+
+static t_queue make_queue(size_t n) {
+  t_queue queue;
+  for (size_t i = 0; i < n; i++) {
+    queue.push("hello");
+  }
+  return queue;
+}
+
+int main() {
+  BENCH("Constructor Default", t_queue queue; bench::do_not_optimize(queue));
+
+  {
+    t_queue queue = make_queue(10000);
+    BENCH("Operator=", t_queue queue_cp = queue;
+          bench::do_not_optimize(queue_cp));
+  }
+
+  {
+    t_queue queue = make_queue(1001);
+    BENCH("front()", bench::do_not_optimize(queue.front()));
+  }
+
+  BENCH_SETUP("push()", t_queue queue, queue.push("hello"));
+
+  BENCH_SETUP("pop()", t_queue queue = make_queue(BENCH_N), queue.pop());
+
+  BENCH_EACH("push() pop() int 10^6", TEST::queue<int> queue,
+             for (int i = 0; i < 1000000; i++) {
+               queue.push(i);
+               if (i % 4 != 0) queue.pop();
+             });
+
+  {
+    t_queue queue = make_queue(1001);
+    t_queue queue2 = make_queue(1001);
+    BENCH("operator==", bench::do_not_optimize(queue == queue2));
+    BENCH("operator<", bench::do_not_optimize(queue < queue2));
+  }
+}
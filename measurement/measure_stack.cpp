@@ -1,101 +1,71 @@
+#include <deque>
 #include <list>
 #include <stack>
 
 #include "Measurement.hpp"
+#include "deque.hpp"
 #include "stack.hpp"
 
-int main() {
-  {
-    // TEST: Constructor Default
-    MEASUREMENT(LOOP(TEST::stack<std::string> stack;));
-  }
-
-  {
-    // TEST: Operator=
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 10000; i++) {
-      stack.push("hello");
-    }
-    MEASUREMENT(TEST::stack<std::string> stack_cp = stack);
-  }
+typedef TEST::stack<std::string> t_stack;
+typedef TEST::stack<int, TEST::deque<int> > t_deque_stack;
 
-  {
-    // TEST: empty() false
-    TEST::stack<std::string> stack;
+static t_stack make_stack(size_t n) {
+  t_stack stack;
+  for (size_t i = 0; i < n; i++) {
     stack.push("hello");
-    MEASUREMENT(LOOP(stack.empty()))
   }
+  return stack;
+}
 
-  {
-    // TEST: empty() true
-    TEST::stack<std::string> stack;
-    MEASUREMENT(LOOP(stack.empty()))
-  }
+int main() {
+  BENCH("Constructor Default", t_stack stack; bench::do_not_optimize(stack));
 
   {
-    // TEST: size()
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 10000; i++) {
-      stack.push("hello");
-    }
-    MEASUREMENT(LOOP(stack.size()))
+    t_stack stack = make_stack(10000);
+    BENCH("Operator=", t_stack stack_cp = stack;
+          bench::do_not_optimize(stack_cp));
   }
 
   {
-    // TEST: top()
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 1001; i++) {
-      stack.push("hello");
-    }
-    MEASUREMENT(LOOP(stack.top()))
+    const t_stack stack = make_stack(1);
+    BENCH("empty() false", bench::do_not_optimize(stack.empty()));
   }
 
   {
-    // TEST: top() const
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 1001; i++) {
-      stack.push("hello");
-    }
-    const TEST::stack<std::string> cstack;
-    MEASUREMENT(LOOP(stack.top()))
+    const t_stack stack;
+    BENCH("empty() true", bench::do_not_optimize(stack.empty()));
   }
 
   {
-    // TEST: push()
-    TEST::stack<std::string> stack;
-    MEASUREMENT(LOOP(stack.push("hello")))
+    const t_stack stack = make_stack(10000);
+    BENCH("size()", bench::do_not_optimize(stack.size()));
   }
 
   {
-    // TEST: pop()
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 100001; i++) {
-      stack.push("hello");
-    }
-    MEASUREMENT(LOOP(stack.pop()))
+    t_stack stack = make_stack(1001);
+    const t_stack& cstack = stack;
+    BENCH("top()", bench::do_not_optimize(stack.top()));
+    BENCH("top() const", bench::do_not_optimize(cstack.top()));
   }
 
-  {
-    TEST::stack<std::string> stack;
-    for (size_t i = 0; i < 1001; i++) {
-      stack.push("hello");
-    }
-    TEST::stack<std::string> stack2;
-    for (size_t i = 0; i < 1001; i++) {
-      stack2.push("hello");
-    }
+  BENCH_SETUP("push()", t_stack stack, stack.push("hello"));
+
+  BENCH_EACH("push() int 10^6", TEST::stack<int> stack,
+             for (int i = 0; i < 1000000; i++) { stack.push(i); });
 
-    // TEST: operator==
-    MEASUREMENT(bool a = (stack == stack2); (void)(a))
-    // TEST: operator!=
-    MEASUREMENT(bool a = (stack != stack2); (void)(a))
-    // TEST: operator>
-    MEASUREMENT(bool a = (stack > stack2); (void)(a))
-    // TEST: operator<
-    MEASUREMENT(bool a = (stack < stack2); (void)(a))
-    // TEST: operator>=
-    MEASUREMENT(bool a = (stack >= stack2); (void)(a))
-    // TEST: operator<=
-    MEASUREMENT(bool a = (stack <= stack2); (void)(a))
+  BENCH_EACH("push() deque int 10^6", t_deque_stack stack,
+             for (int i = 0; i < 1000000; i++) { stack.push(i); });
+
+  BENCH_SETUP("pop()", t_stack stack = make_stack(BENCH_N), stack.pop());
+
+  {
+    t_stack stack = make_stack(1001);
+    t_stack stack2 = make_stack(1001);
+    BENCH("operator==", bench::do_not_optimize(stack == stack2));
+    BENCH("operator!=", bench::do_not_optimize(stack != stack2));
+    BENCH("operator>", bench::do_not_optimize(stack > stack2));
+    BENCH("operator<", bench::do_not_optimize(stack < stack2));
+    BENCH("operator>=", bench::do_not_optimize(stack >= stack2));
+    BENCH("operator<=", bench::do_not_optimize(stack <= stack2));
   }
-}
\ No newline at end of file
+}
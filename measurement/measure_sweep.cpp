@@ -0,0 +1,71 @@
+#include <map>
+#include <stack>
+#include <vector>
+
+#include "Measurement.hpp"
+#include "map.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+// Core operations of vector, map and stack at every size of
+// bench::sweep_sizes(), in ns per operation. Lookups go to random
+// positions, so the cost per operation shows where the working set stops
+// fitting in each cache level, and whether it grows like O(1) or O(log n).
+
+typedef TEST::vector<int> t_vector;
+typedef TEST::map<int, int> t_map;
+typedef TEST::stack<int> t_stack;
+
+static const size_t probes = 1 << 16;
+
+int main() {
+  const std::vector<size_t> sizes = bench::sweep_sizes();
+  for (size_t s = 0; s < sizes.size(); s++) {
+    const size_t n = sizes[s];
+    const std::vector<unsigned int> idx = bench::random_indices(n, probes);
+
+    {
+      t_vector vec(n, 42);
+      BENCH_SIZED("vector operator[] random", n, 1,
+                  bench::do_not_optimize(vec[idx[BENCH_I & (probes - 1)]]));
+      BENCH_SIZED("vector iterate", n, n, long sum = 0;
+                  for (t_vector::const_iterator it = vec.begin();
+                       it != vec.end(); ++it) { sum += *it; };
+                  bench::do_not_optimize(sum));
+    }
+
+    BENCH_EACH_SIZED("vector push_back", n, n, t_vector vec,
+                     for (size_t i = 0; i < n; i++) { vec.push_back(i); });
+
+    {
+      const std::vector<int> keys = bench::shuffled(n);
+      t_map map;
+      for (size_t i = 0; i < n; i++) {
+        map.insert(TEST::make_pair(keys[i], keys[i]));
+      }
+      BENCH_SIZED("map find random", n, 1,
+                  bench::do_not_optimize(
+                      map.find(idx[BENCH_I & (probes - 1)])));
+      // Erasing and reinserting the same key keeps the size at n.
+      BENCH_SIZED("map erase insert random", n, 2,
+                  int key = idx[BENCH_I & (probes - 1)];
+                  map.erase(key); map.insert(TEST::make_pair(key, key)));
+      BENCH_SIZED("map iterate", n, n, long sum = 0;
+                  for (t_map::const_iterator it = map.begin();
+                       it != map.end(); ++it) { sum += it->second; };
+                  bench::do_not_optimize(sum));
+    }
+
+    BENCH_EACH_SIZED("stack push", n, n, t_stack stack,
+                     for (size_t i = 0; i < n; i++) { stack.push(i); });
+
+    {
+      t_stack stack;
+      for (size_t i = 0; i < n; i++) {
+        stack.push(i);
+      }
+      // One push and one pop at depth n.
+      BENCH_SIZED("stack push pop", n, 2, stack.push(BENCH_I); stack.pop());
+    }
+  }
+}
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Measurement.hpp"
+#include "Trace.hpp"
+#include "map.hpp"
+
+// Replays operation traces against a map, in ns per operation. Every
+// pattern of Trace.hpp runs with int keys, 23 character string keys (past
+// the small string buffer, with a long common prefix as real ids have) and
+// 64 byte struct keys. The map starts with a random part of the key space
+// and the trace is replayed from where the previous sample stopped.
+//
+// Tuned through the environment, besides the BENCH_* options:
+//   BENCH_TRACE_KEYS     key space of the generated traces (default 10^5)
+//   BENCH_TRACE_MIX      find/insert/erase percentages (default 80/10/10)
+//   BENCH_TRACE_PREFILL  percent of the key space inserted first (default 50)
+//   BENCH_TRACE_FILE     replay this trace file instead of the patterns
+
+struct record_key {
+  int id;
+  char payload[60];
+};
+
+bool operator<(const record_key& lhs, const record_key& rhs) {
+  return lhs.id < rhs.id;
+}
+
+static void make_key(unsigned int index, int& key) {
+  key = static_cast<int>(index);
+}
+
+static void make_key(unsigned int index, std::string& key) {
+  char buf[32];
+  sprintf(buf, "user/%010u/profile", index);
+  key = buf;
+}
+
+static void make_key(unsigned int index, record_key& key) {
+  key.id = static_cast<int>(index);
+  for (size_t i = 0; i < sizeof(key.payload); i++) {
+    key.payload[i] = static_cast<char>(index + i);
+  }
+}
+
+template <class Key>
+class replay {
+ public:
+  typedef TEST::map<Key, int> map_type;
+
+  replay(const std::vector<bench::trace_op>& trace, size_t keyspace,
+         size_t prefill)
+      : trace_(trace), pos_(0), keys_(keyspace) {
+    for (size_t i = 0; i < keyspace; i++) {
+      make_key(static_cast<unsigned int>(i), keys_[i]);
+    }
+    const std::vector<int> order = bench::shuffled(keyspace, 7);
+    for (size_t i = 0; i < prefill; i++) {
+      map_.insert(TEST::make_pair(keys_[order[i]], order[i]));
+    }
+  }
+
+  void step() {
+    const bench::trace_op& op = trace_[pos_];
+    if (++pos_ == trace_.size()) pos_ = 0;
+    switch (op.kind) {
+      case bench::trace_find:
+        bench::do_not_optimize(map_.find(keys_[op.key]));
+        break;
+      case bench::trace_insert:
+        map_.insert(TEST::make_pair(keys_[op.key], static_cast<int>(op.key)));
+        break;
+      default:
+        map_.erase(keys_[op.key]);
+    }
+  }
+
+ private:
+  const std::vector<bench::trace_op>& trace_;
+  size_t pos_;
+  std::vector<Key> keys_;
+  map_type map_;
+};
+
+template <class Key>
+static void run(const std::string& name,
+                const std::vector<bench::trace_op>& trace, size_t keyspace,
+                size_t prefill) {
+  replay<Key> r(trace, keyspace, prefill);
+  BENCH_SIZED(name.c_str(), keyspace, 1, r.step());
+}
+
+static void run_all(const std::string& name,
+                    const std::vector<bench::trace_op>& trace,
+                    size_t keyspace, size_t prefill) {
+  run<int>("map<int> " + name, trace, keyspace, prefill);
+  run<std::string>("map<string> " + name, trace, keyspace, prefill);
+  run<record_key>("map<record> " + name, trace, keyspace, prefill);
+}
+
+static double env(const char* name, double fallback) {
+  const char* value = getenv(name);
+  return value != NULL && *value != '\0' ? strtod(value, NULL) : fallback;
+}
+
+int main() {
+  static const size_t trace_length = 1 << 20;
+  const char* path = getenv("BENCH_TRACE_FILE");
+  const char* mix_text = getenv("BENCH_TRACE_MIX");
+  const double keys = env("BENCH_TRACE_KEYS", 1e5);
+  const double percent = env("BENCH_TRACE_PREFILL", 50);
+  if (!(percent >= 0 && percent <= 100)) {
+    std::cerr << "BENCH_TRACE_PREFILL: expected a percentage from 0 to 100, "
+                 "got "
+              << getenv("BENCH_TRACE_PREFILL") << std::endl;
+    return 1;
+  }
+  if (!(keys >= 1)) {
+    std::cerr << "BENCH_TRACE_KEYS: must be positive" << std::endl;
+    return 1;
+  }
+  size_t keyspace = static_cast<size_t>(keys);
+  const double prefill = percent / 100;
+
+  if (path != NULL && *path != '\0') {
+    std::vector<bench::trace_op> trace;
+    if (!bench::read_trace(path, trace, keyspace)) return 1;
+    run_all("trace", trace, keyspace,
+            static_cast<size_t>(keyspace * prefill));
+    return 0;
+  }
+
+  bench::trace_mix mix = {80, 10, 10};
+  if (mix_text != NULL && !bench::trace_mix::parse(mix_text, mix)) {
+    std::cerr << "BENCH_TRACE_MIX: expected find/insert/erase percentages "
+                 "adding up to 100, got "
+              << mix_text << std::endl;
+    return 1;
+  }
+  for (const char* const* pattern = bench::trace_patterns(); *pattern != NULL;
+       pattern++) {
+    const std::vector<bench::trace_op> trace =
+        bench::generate_trace(*pattern, keyspace, trace_length, mix);
+    run_all(std::string(*pattern) + ' ' + mix.str(), trace, keyspace,
+            static_cast<size_t>(keyspace * prefill));
+  }
+}
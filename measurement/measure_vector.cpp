@@ -4,284 +4,148 @@
 #include "Measurement.hpp"
 #include "vector.hpp"
 
+typedef TEST::vector<std::string> t_vector;
+
 int main() {
   std::list<std::string> lst;
   for (size_t i = 0; i < 10000; i++) {
     lst.push_back("hello");
   }
 
-  {
-    // TEST: Constructor Default
-    MEASUREMENT(LOOP(TEST::vector<std::string> vec1;));
-  }
+  BENCH("Constructor Default", t_vector vec; bench::do_not_optimize(vec));
 
-  {
-    // TEST: Fill Allocator
-    MEASUREMENT(TEST::vector<std::string> vec1(10000, "hello"));
-  }
+  BENCH("Fill Allocator", t_vector vec(10000, "hello");
+        bench::do_not_optimize(vec));
 
   {
-    // TEST: Constructor Copy
-    TEST::vector<std::string> vec;
+    t_vector vec;
     vec.push_back("hello");
     vec.push_back("helo");
     vec.push_back("heo");
-    MEASUREMENT(LOOP(TEST::vector<std::string> vec1(vec)));
-  }
-
-  {
-    // TEST: Constructor Range
-    MEASUREMENT(TEST::vector<std::string> vec(lst.begin(), lst.end()));
-  };
-
-  {
-    // TEST: Constructor Size Value
-    MEASUREMENT(TEST::vector<std::string> vec(10000, "hello"));
-  }
-
-  {// TEST: Destructor
-   MEASUREMENT({ TEST::vector<std::string> vec(10000, "hello"); })}
-
-  {
-    // TEST: Operator=
-    TEST::vector<std::string> vec(1000, "hello");
-    TEST::vector<std::string> vec2(10000, "world");
-    MEASUREMENT(vec = vec2);
-  }
-
-  {
-    // TEST: begin()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.begin()))
-  }
-
-  {
-    // TEST: begin() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.begin()))
-  }
-
-  {
-    // TEST: end()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.end()))
-  }
-
-  {
-    // TEST: end() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.end()))
-  }
-
-  {
-    // TEST: rbegin()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.rbegin()))
-  }
-
-  {
-    // TEST: rbegin() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.rbegin()))
-  }
-
-  {
-    // TEST: rend()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.rend()))
-  }
-
-  {
-    // TEST: rend() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.rend()))
-  }
-
-  {
-    // TEST: size()
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.size()))
+    BENCH("Constructor Copy", t_vector vec1(vec); bench::do_not_optimize(vec1));
   }
 
-  {
-    // TEST: max_size()
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.max_size()))
-  }
+  BENCH("Constructor Range", t_vector vec(lst.begin(), lst.end());
+        bench::do_not_optimize(vec));
 
-  {
-    // TEST: resize()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.resize(10000)))
-  }
+  BENCH("Constructor Size Value", t_vector vec(10000, "hello");
+        bench::do_not_optimize(vec));
 
-  {
-    // TEST: capacity()
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.capacity()))
-  }
+  BENCH_EACH("Destructor", t_vector* vec = new t_vector(10000, "hello"),
+             delete vec);
 
   {
-    // TEST: empty() false
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.empty()))
+    t_vector vec2(10000, "world");
+    BENCH_EACH("Operator=", t_vector vec(1000, "hello"), vec = vec2);
   }
 
   {
-    // TEST: empty() true
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.empty()))
+    t_vector vec(10000, "hello");
+    const t_vector& cvec = vec;
+    BENCH("begin()", bench::do_not_optimize(vec.begin()));
+    BENCH("begin() const", bench::do_not_optimize(cvec.begin()));
+    BENCH("end()", bench::do_not_optimize(vec.end()));
+    BENCH("end() const", bench::do_not_optimize(cvec.end()));
+    BENCH("rbegin()", bench::do_not_optimize(vec.rbegin()));
+    BENCH("rbegin() const", bench::do_not_optimize(cvec.rbegin()));
+    BENCH("rend()", bench::do_not_optimize(vec.rend()));
+    BENCH("rend() const", bench::do_not_optimize(cvec.rend()));
+    BENCH("size()", bench::do_not_optimize(cvec.size()));
+    BENCH("max_size()", bench::do_not_optimize(cvec.max_size()));
+    BENCH("resize()", vec.resize(10000); bench::do_not_optimize(vec));
+    BENCH("capacity()", bench::do_not_optimize(cvec.capacity()));
+    BENCH("empty() false", bench::do_not_optimize(cvec.empty()));
   }
 
   {
-    // TEST: reserve()
-    TEST::vector<std::string> vec(1000, "hello");
-    MEASUREMENT(vec.reserve(10000))
+    const t_vector vec;
+    BENCH("empty() true", bench::do_not_optimize(vec.empty()));
   }
 
-  {
-    // TEST: operator[]
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { vec[i]; })
-  }
+  BENCH_EACH("reserve()", t_vector vec(1000, "hello"), vec.reserve(10000));
 
   {
-    // TEST: operator[] const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { vec[i]; })
+    t_vector vec(10000, "hello");
+    const t_vector& cvec = vec;
+    BENCH("operator[]", bench::do_not_optimize(vec[BENCH_I % 10000]));
+    BENCH("operator[] const", bench::do_not_optimize(cvec[BENCH_I % 10000]));
+    BENCH("at()", bench::do_not_optimize(vec.at(BENCH_I % 10000)));
+    BENCH("at() const", bench::do_not_optimize(cvec.at(BENCH_I % 10000)));
+    BENCH("front()", bench::do_not_optimize(vec.front()));
+    BENCH("front() const", bench::do_not_optimize(cvec.front()));
+    BENCH("back()", bench::do_not_optimize(vec.back()));
+    BENCH("back() const", bench::do_not_optimize(cvec.back()));
+    BENCH("assign Range", vec.assign(lst.begin(), lst.end()));
+    BENCH("assign size value", vec.assign(10000, "world"));
   }
 
-  {
-    // TEST: at()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { vec.at(i); })
-  }
+  BENCH_SETUP("push_back()", t_vector vec, vec.push_back("hello"));
 
-  {
-    // TEST: at() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(for (size_t i = 0; i < 10000; i++) { vec.at(i); })
-  }
+  BENCH_SETUP("pop_back()", t_vector vec(BENCH_N, "hello"), vec.pop_back());
 
-  {
-    // TEST: front()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.front()))
-  }
+  BENCH_EACH("insert position value", t_vector vec(1, "hello"),
+             for (size_t i = 0; i < 1000;
+                  i++) { vec.insert(vec.begin(), "hello"); });
 
-  {
-    // TEST: front() const
-    const TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.front()))
-  }
+  BENCH_EACH("insert position size value", t_vector vec(1, "hello"),
+             vec.insert(vec.begin(), 10000, "hello"));
 
-  {
-    // TEST: back()
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.back()))
-  }
+  BENCH_EACH("insert position Range", t_vector vec(1, "hello"),
+             vec.insert(vec.begin(), lst.begin(), lst.end()));
 
-  {
-    // TEST: back() const
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.back()))
-  }
+  BENCH_SETUP("erase position", t_vector vec(BENCH_N, "hello"),
+              vec.erase(vec.end() - 1));
 
-  {
-    // TEST: assign Range
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(vec.assign(lst.begin(), lst.end()))
-  }
-
-  {
-    // TEST: assign size value
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(vec.assign(10000, "world"))
-  }
-
-  {
-    // TEST: push_back()
-    TEST::vector<std::string> vec;
-    MEASUREMENT(LOOP(vec.push_back("hello")))
-  }
-
-  {
-    // TEST: pop_back()
-    TEST::vector<std::string> vec(20000, "hello");
-    MEASUREMENT(LOOP(vec.pop_back()))
-  }
+  BENCH_EACH("erase Range", t_vector vec(20000, "hello"),
+             vec.erase(vec.begin(), vec.end() - 100));
 
   {
-    // TEST: insert position value
-    TEST::vector<std::string> vec(1, "hello");
-    MEASUREMENT(LOOP(vec.insert(vec.begin(), "hello")))
+    t_vector vec(20000, "hello");
+    t_vector vec2(20000, "world");
+    BENCH("swap", vec.swap(vec2); bench::do_not_optimize(vec));
   }
 
-  {
-    // TEST: insert position size value
-    TEST::vector<std::string> vec(1, "hello");
-    MEASUREMENT(vec.insert(vec.begin(), 10000, "hello"))
-  }
-
-  {
-    // TEST: insert position Range
-    TEST::vector<std::string> vec(1, "hello");
-    MEASUREMENT(vec.insert(vec.begin(), lst.begin(), lst.end()))
-  }
+  BENCH_EACH("clear", t_vector vec(10000, "hello"), vec.clear());
 
-  {
-    // TEST: erase position
-    TEST::vector<std::string> vec(20000, "hello");
-    MEASUREMENT(LOOP(vec.erase(vec.end() - 1)))
-  }
+  BENCH_EACH("clear int 10^7", TEST::vector<int> vec(10000000, 42),
+             vec.clear());
 
-  {
-    // TEST: erase Range
-    TEST::vector<std::string> vec(20000, "hello");
-    MEASUREMENT(vec.erase(vec.begin(), vec.end() - 100))
-  }
+  BENCH_EACH("erase Range int 10^7", TEST::vector<int> vec(10000000, 42),
+             vec.erase(vec.begin() + 1, vec.end()));
 
   {
-    // TEST: swap
-    TEST::vector<std::string> vec(20000, "hello");
-    TEST::vector<std::string> vec2(20000, "world");
-    MEASUREMENT(LOOP(vec.swap(vec2)))
+    t_vector vec(10000, "hello");
+    BENCH("get_allocator", bench::do_not_optimize(vec.get_allocator()));
   }
 
   {
-    // TEST: clear
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(vec.clear())
+    t_vector vec(10000, "hello");
+    t_vector vec2(10000, "hello");
+    BENCH("operator==", bench::do_not_optimize(vec == vec2));
+    BENCH("operator!=", bench::do_not_optimize(vec != vec2));
+    BENCH("operator>", bench::do_not_optimize(vec > vec2));
+    BENCH("operator<", bench::do_not_optimize(vec < vec2));
+    BENCH("operator>=", bench::do_not_optimize(vec >= vec2));
+    BENCH("operator<=", bench::do_not_optimize(vec <= vec2));
   }
 
   {
-    // TEST: get_allocator
-    TEST::vector<std::string> vec(10000, "hello");
-    MEASUREMENT(LOOP(vec.get_allocator()))
+    TEST::vector<int> vec(1000000, 42);
+    TEST::vector<int> vec2(1000000, 42);
+    BENCH("operator== int 10^6", bench::do_not_optimize(vec == vec2));
+    BENCH("operator< int 10^6", bench::do_not_optimize(vec < vec2));
   }
 
   {
-    TEST::vector<std::string> vec(10000, "hello");
-    TEST::vector<std::string> vec2(10000, "hello");
-
-    // TEST: operator==
-    MEASUREMENT(bool a = (vec == vec2); (void)(a))
-    // TEST: operator!=
-    MEASUREMENT(bool a = (vec != vec2); (void)(a))
-    // TEST: operator>
-    MEASUREMENT(bool a = (vec > vec2); (void)(a))
-    // TEST: operator<
-    MEASUREMENT(bool a = (vec < vec2); (void)(a))
-    // TEST: operator>=
-    MEASUREMENT(bool a = (vec >= vec2); (void)(a))
-    // TEST: operator<=
-    MEASUREMENT(bool a = (vec <= vec2); (void)(a))
+    TEST::vector<char> vec(1000000, 'a');
+    TEST::vector<char> vec2(1000000, 'a');
+    BENCH("operator== char 10^6", bench::do_not_optimize(vec == vec2));
+    BENCH("operator< char 10^6", bench::do_not_optimize(vec < vec2));
   }
 
   {
-    // TEST: swap()
-    TEST::vector<std::string> vec(10000, "hello");
-    TEST::vector<std::string> vec2(10000, "hello");
-    MEASUREMENT(LOOP(swap(vec, vec2)))
+    t_vector vec(10000, "hello");
+    t_vector vec2(10000, "hello");
+    BENCH("swap()", swap(vec, vec2); bench::do_not_optimize(vec));
   }
-}
\ No newline at end of file
+}
@@ -1,34 +1,51 @@
 import sys
 
-with open(sys.argv[2]) as f:
-    std_log = f.read().split('\n')
-with open(sys.argv[3]) as f:
-    ft_log = f.read().split('\n')
-with open(sys.argv[4]) as f:
-    test_log = f.read().split('\n')
-
-print(f'--------{sys.argv[1]}--------')
-
-std_c = len(std_log)
-ft_c = len(ft_log)
-test_c = len(test_log)
-
-if(std_c != ft_c and
-   std_c != test_c and
-   ft_c != test_c):
+
+def read_log(path):
+    with open(path) as f:
+        lines = [line.rstrip('\n').split('\t') for line in f if line.strip()]
+    header = lines[0]
+    return header, [dict(zip(header, line)) for line in lines[1:]]
+
+
+header, std_log = read_log(sys.argv[2])
+_, ft_log = read_log(sys.argv[3])
+# Timing logs are compared on the median, latency logs on p99 (their p50 is
+# often below the timer resolution), others on their first column. Only
+# times get the OK/NG verdict (ft within 20x of std); for other metrics,
+# such as bytes per element, that bound means nothing and only the ratio
+# is shown.
+if 'median_ns' in header:
+    metric = 'median_ns'
+elif 'p99_ns' in header:
+    metric = 'p99_ns'
+else:
+    metric = header[1]
+timed = metric.endswith('_ns')
+
+print(f'--------{sys.argv[1]} ({metric})--------')
+
+if [c['name'] for c in std_log] != [c['name'] for c in ft_log]:
     print('Error')
-    exit
+    sys.exit(1)
 
 green = '\033[32m'
 red = '\033[31m'
 reset = '\033[0m'
 
-for i in range(len(std_log) - 1):
-    std_res = int(std_log[i])
-    ft_res = int(ft_log[i])
+for std_case, ft_case in zip(std_log, ft_log):
+    std_res = float(std_case[metric])
+    ft_res = float(ft_case[metric])
     res = red + 'NG!' + reset
     if ft_res <= (std_res * 20):
         res = green + 'OK!' + reset
-    print(f'{res} : {test_log[i]}')
+    if not timed:
+        res = '   '
+    if std_res > 0:
+        ratio = ft_res / std_res
+    else:
+        ratio = 1.0 if ft_res == 0 else float('inf')
+    print(f'{res} : {ft_case["name"]} std {std_res:g} ft {ft_res:g} '
+          f'(ft/std {ratio:.2f})')
 
 print()
@@ -1,37 +1,103 @@
 #!/usr/bin/env bash
 
-cmpl="clang++ -Wall -Werror -Wextra -std=c++98  -I ../includes"
+# ./measurement.sh                   std against ft for every program
+# ./measurement.sh vector            std against ft for one program
+# ./measurement.sh baseline [prog]   save the ft results as baseline/<prog>.json
+# ./measurement.sh check [prog]      compare ft with the saved baseline; exits
+#                                    non-zero on a regression (THRESHOLD in %)
+#
+# CXX and BENCH_CXXFLAGS choose the compiler and optimization flags (default
+# clang++ -O2). With BENCH_PGO=1 every program is built instrumented, run
+# once as training and rebuilt with the profile. `make bench` sets these
+# from a named profile.
 
-function grepTest() {
-	cat ./measure_$1.cpp | grep '//' | sed -e 's/.* TEST: //g'
-}
+cxx=${CXX:-clang++}
+flags=${BENCH_CXXFLAGS--O2}
+cmpl="$cxx -Wall -Werror -Wextra -std=c++98 -I ../includes $flags"
+timed="vector stack queue priority_queue map sweep trace locality"
+programs="$timed memory latency"
 
 function clean() {
-	rm $1_std.compare
-	rm $1_ft.compare
-	rm $1_std.log
-	rm $1_ft.log
-	rm $1_test.log
+	rm -f $1_std.compare
+	rm -f $1_ft.compare
+	rm -f $1_std.log
+	rm -f $1_ft.log
+	rm -rf pgo/$1_STD* pgo/$1_FT*
+}
+
+# compile <prog> <STD|FT> <output>
+function compile() {
+	local src=measure_$1.cpp
+	local tag="-DBENCH_FLAGS=\"$flags${BENCH_PGO:+ pgo}\""
+	if [ -z "$BENCH_PGO" ]; then
+		$cmpl "$tag" -D $2 $src -o $3
+		return
+	fi
+	local dir=$PWD/pgo/$1_$2
+	rm -rf $dir
+	$cmpl "$tag" -D $2 -fprofile-generate=$dir $src -o $3 || return 1
+	BENCH_MIN_TIME=1 BENCH_WARMUP=0 BENCH_REPS=1 ./$3 > /dev/null || return 1
+	if $cxx --version | grep -q clang; then
+		${LLVM_PROFDATA:-llvm-profdata} merge -o $dir.profdata $dir || return 1
+		$cmpl "$tag" -D $2 -fprofile-use=$dir.profdata $src -o $3
+	else
+		$cmpl "$tag" -D $2 -fprofile-use=$dir $src -o $3
+	fi
 }
 
 function measure() {
 
 clean $1
-$cmpl measure_$1.cpp -D STD -o $1_std.compare 
-$cmpl measure_$1.cpp -D FT  -o $1_ft.compare 
+compile $1 STD $1_std.compare || exit 1
+compile $1 FT  $1_ft.compare  || exit 1
 
 ./$1_std.compare > $1_std.log
 ./$1_ft.compare  > $1_ft.log
-grepTest $1 > $1_test.log
 
-python3 measurement.py $1 $1_std.log $1_ft.log $1_test.log
+python3 measurement.py $1 $1_std.log $1_ft.log
 }
 
+function run_json() {
+	compile $1 FT $1_ft.compare || exit 1
+	BENCH_FORMAT=json ./$1_ft.compare > $2 || exit 1
+	rm -f $1_ft.compare
+}
+
+function baseline() {
+	mkdir -p baseline
+	run_json $1 baseline/$1.json
+	echo "saved baseline/$1.json"
+}
+
+function check() {
+	if [ ! -f baseline/$1.json ]; then
+		echo "no baseline/$1.json, run ./measurement.sh baseline $1 first"
+		return 1
+	fi
+	run_json $1 $1_current.json
+	python3 compare.py baseline/$1.json $1_current.json \
+		--threshold ${THRESHOLD:-5}
+	local status=$?
+	rm -f $1_current.json
+	return $status
+}
+
+if [ "$1" = "baseline" ] || [ "$1" = "check" ]; then
+	mode=$1
+	shift
+	status=0
+	for prog in ${@:-$timed}; do
+		echo "--------$prog--------"
+		$mode $prog || status=1
+	done
+	exit $status
+fi
+
 if [ $# -eq 1 ];then
 	measure $1
-    exit 1
+	exit
 fi
 
-measure vector
-measure stack
-measure map
+for prog in $programs; do
+	measure $prog
+done
@@ -0,0 +1,89 @@
+#include "concurrent_stack.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(concurrent_stack, pushPop) {
+  ft::concurrent_stack<std::string> stack;
+  std::string out;
+
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.try_pop(out));
+
+  for (int i = 0; i < 1000; i++) {
+    stack.push(std::string(i % 17, 'a'));
+  }
+  EXPECT_FALSE(stack.empty());
+
+  for (int i = 999; i >= 0; i--) {
+    EXPECT_TRUE(stack.try_pop(out));
+    EXPECT_EQ(out, std::string(i % 17, 'a'));
+  }
+  EXPECT_FALSE(stack.try_pop(out));
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, recycleNodes) {
+  ft::concurrent_stack<int> stack;
+  int out;
+
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 50; i++) {
+      stack.push(i);
+    }
+    for (int i = 49; i >= 0; i--) {
+      EXPECT_TRUE(stack.try_pop(out));
+      EXPECT_EQ(out, i);
+    }
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, destroyRemaining) {
+  ft::concurrent_stack<std::string> stack;
+  for (int i = 0; i < 300; i++) {
+    stack.push(std::string(100, 'a'));
+  }
+}
+
+TEST(concurrent_stack, multipleThreads) {
+  const size_t threads = 4;
+  const size_t per_thread = 20000;
+  ft::concurrent_stack<size_t> stack;
+  std::vector<size_t> sums(threads, 0);
+  std::vector<std::thread> workers;
+
+  for (size_t t = 0; t < threads; t++) {
+    workers.push_back(std::thread([&, t]() {
+      for (size_t i = 0; i < per_thread; i++) {
+        stack.push(t * per_thread + i);
+        size_t value;
+        if (i % 2 == 1) {
+          while (!stack.try_pop(value)) {
+          }
+          sums[t] += value;
+        }
+      }
+    }));
+  }
+  for (size_t t = 0; t < threads; t++) {
+    workers[t].join();
+  }
+
+  size_t total = 0;
+  for (size_t t = 0; t < threads; t++) {
+    total += sums[t];
+  }
+  size_t value;
+  size_t left = 0;
+  while (stack.try_pop(value)) {
+    total += value;
+    left++;
+  }
+  size_t n = threads * per_thread;
+  EXPECT_EQ(left, n / 2);
+  EXPECT_EQ(total, n * (n - 1) / 2);
+}
@@ -0,0 +1,302 @@
+#include "deque.hpp"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <stack>
+#include <string>
+
+#include "stack.hpp"
+
+template <class T>
+bool equal(const ft::deque<T>& ft, const std::deque<T>& std) {
+  if (ft.size() != std.size() || ft.empty() != std.empty()) return false;
+  for (size_t i = 0; i < ft.size(); i++) {
+    if (ft[i] != std[i]) return false;
+  }
+  return true;
+}
+
+TEST(deque, defaultConstructor) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+  EXPECT_TRUE(ft_deq.begin() == ft_deq.end());
+}
+
+TEST(deque, FillConstructor) {
+  std::deque<int> std_deq(5000, 10);
+  ft::deque<int> ft_deq(5000, 10);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, RangeConstructor) {
+  std::list<int> lst;
+  for (size_t i = 0; i < 3000; i++) {
+    lst.push_back(i);
+  }
+
+  std::deque<int> std_deq(lst.begin(), lst.end());
+  ft::deque<int> ft_deq(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, CopyConstructor) {
+  std::deque<std::string> std_deq(100, "hello");
+  ft::deque<std::string> ft_deq(100, "hello");
+  ft::deque<std::string> ft_deq2(ft_deq);
+  EXPECT_TRUE(equal(ft_deq2, std_deq));
+  EXPECT_NE(&ft_deq[0], &ft_deq2[0]);
+}
+
+TEST(deque, pushBothEnds) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+
+  for (int i = 0; i < 10000; i++) {
+    std_deq.push_back(i);
+    ft_deq.push_back(i);
+    std_deq.push_front(-i);
+    ft_deq.push_front(-i);
+  }
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+  EXPECT_EQ(ft_deq.front(), std_deq.front());
+  EXPECT_EQ(ft_deq.back(), std_deq.back());
+
+  ft_deq.push_back(ft_deq.front());
+  std_deq.push_back(std_deq.front());
+  ft_deq.push_front(ft_deq.back());
+  std_deq.push_front(std_deq.back());
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, popBothEnds) {
+  std::deque<std::string> std_deq;
+  ft::deque<std::string> ft_deq;
+
+  for (int i = 0; i < 1000; i++) {
+    std_deq.push_back("hello");
+    ft_deq.push_back("hello");
+    std_deq.push_front("world");
+    ft_deq.push_front("world");
+  }
+  for (int i = 0; i < 700; i++) {
+    std_deq.pop_back();
+    ft_deq.pop_back();
+    std_deq.pop_front();
+    ft_deq.pop_front();
+  }
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  ft_deq.clear();
+  ft_deq.pop_back();
+  ft_deq.pop_front();
+  EXPECT_TRUE(ft_deq.empty());
+}
+
+TEST(deque, queueUsage) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+
+  for (int i = 0; i < 100000; i++) {
+    std_deq.push_back(i);
+    ft_deq.push_back(i);
+    if (i % 3 != 0) {
+      std_deq.pop_front();
+      ft_deq.pop_front();
+    }
+  }
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, stableReferences) {
+  ft::deque<int> ft_deq;
+  ft_deq.push_back(1);
+  int* front = &ft_deq.front();
+
+  for (int i = 0; i < 100000; i++) {
+    ft_deq.push_back(i);
+    ft_deq.push_front(i);
+  }
+  EXPECT_EQ(front, &ft_deq[100000]);
+  EXPECT_EQ(*front, 1);
+}
+
+TEST(deque, iterator) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+  for (int i = 0; i < 5000; i++) {
+    std_deq.push_front(i);
+    ft_deq.push_front(i);
+  }
+
+  ft::deque<int>::iterator it = ft_deq.begin();
+  ft::deque<int>::const_iterator cit = it;
+  EXPECT_TRUE(cit == it);
+  EXPECT_EQ(ft_deq.end() - ft_deq.begin(), 5000);
+  EXPECT_EQ(it[1234], std_deq[1234]);
+  EXPECT_EQ(*(it + 4000), std_deq[4000]);
+  EXPECT_EQ(*(4000 + it), std_deq[4000]);
+  it += 10;
+  it -= 3;
+  EXPECT_EQ(*it, std_deq[7]);
+  EXPECT_TRUE(ft_deq.begin() < it);
+
+  std::deque<int>::reverse_iterator std_rit = std_deq.rbegin();
+  for (ft::deque<int>::reverse_iterator rit = ft_deq.rbegin();
+       rit != ft_deq.rend(); ++rit, ++std_rit) {
+    EXPECT_EQ(*rit, *std_rit);
+  }
+}
+
+TEST(deque, at) {
+  ft::deque<int> ft_deq(10, 1);
+  const ft::deque<int> cft_deq(10, 1);
+  EXPECT_EQ(ft_deq.at(9), 1);
+  EXPECT_EQ(cft_deq.at(9), 1);
+  EXPECT_THROW(ft_deq.at(10), std::out_of_range);
+  EXPECT_THROW(cft_deq.at(10), std::out_of_range);
+}
+
+TEST(deque, resize) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+
+  std_deq.resize(3000, 7);
+  ft_deq.resize(3000, 7);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  std_deq.resize(2);
+  ft_deq.resize(2);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, insert) {
+  std::deque<int> std_deq(3000, 1);
+  ft::deque<int> ft_deq(3000, 1);
+
+  std::deque<int>::iterator std_it = std_deq.insert(std_deq.begin() + 1, 2);
+  ft::deque<int>::iterator ft_it = ft_deq.insert(ft_deq.begin() + 1, 2);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+  EXPECT_EQ(*ft_it, *std_it);
+
+  std_deq.insert(std_deq.end(), 10, 4);
+  ft_deq.insert(ft_deq.end(), 10, 4);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  std::list<int> lst(5, 9);
+  std_deq.insert(std_deq.begin() + 2000, lst.begin(), lst.end());
+  ft_deq.insert(ft_deq.begin() + 2000, lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, erase) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+  for (int i = 0; i < 5000; i++) {
+    std_deq.push_back(i);
+    ft_deq.push_back(i);
+  }
+
+  std_deq.erase(std_deq.begin() + 3);
+  ft_deq.erase(ft_deq.begin() + 3);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  std::deque<int>::iterator std_it =
+      std_deq.erase(std_deq.end() - 100, std_deq.end() - 10);
+  ft::deque<int>::iterator ft_it =
+      ft_deq.erase(ft_deq.end() - 100, ft_deq.end() - 10);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+  EXPECT_EQ(*ft_it, *std_it);
+
+  std_deq.erase(std_deq.begin(), std_deq.begin() + 1500);
+  ft_deq.erase(ft_deq.begin(), ft_deq.begin() + 1500);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, assign) {
+  std::deque<int> std_deq(10, 1);
+  ft::deque<int> ft_deq(10, 1);
+
+  std_deq.assign(5000, 3);
+  ft_deq.assign(5000, 3);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  std::list<int> lst(7, 9);
+  std_deq.assign(lst.begin(), lst.end());
+  ft_deq.assign(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, shrinkToFit) {
+  std::deque<int> std_deq;
+  ft::deque<int> ft_deq;
+  for (int i = 0; i < 10000; i++) {
+    std_deq.push_back(i);
+    ft_deq.push_back(i);
+  }
+  for (int i = 0; i < 9000; i++) {
+    std_deq.pop_front();
+    ft_deq.pop_front();
+  }
+  ft_deq.shrink_to_fit();
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+
+  ft_deq.push_front(1);
+  std_deq.push_front(1);
+  EXPECT_TRUE(equal(ft_deq, std_deq));
+}
+
+TEST(deque, swap) {
+  ft::deque<int> ft_deq(2, 1);
+  ft::deque<int> ft_deq2(10000, 2);
+  ft::deque<int> ft_cp = ft_deq;
+  ft::deque<int> ft_cp2 = ft_deq2;
+  int* elem = &ft_deq2[5];
+
+  ft_deq.swap(ft_deq2);
+  EXPECT_EQ(ft_deq, ft_cp2);
+  EXPECT_EQ(ft_deq2, ft_cp);
+  EXPECT_EQ(elem, &ft_deq[5]);
+
+  ft::swap(ft_deq, ft_deq2);
+  EXPECT_EQ(ft_deq, ft_cp);
+  EXPECT_EQ(ft_deq2, ft_cp2);
+}
+
+TEST(deque, relationalOperator) {
+  ft::deque<int> ft_deq(3, 1);
+  ft::deque<int> ft_deq2(3, 2);
+
+  EXPECT_TRUE(ft_deq == ft_deq);
+  EXPECT_TRUE(ft_deq != ft_deq2);
+  EXPECT_TRUE(ft_deq < ft_deq2);
+  EXPECT_TRUE(ft_deq2 > ft_deq);
+  EXPECT_TRUE(ft_deq <= ft_deq2);
+  EXPECT_TRUE(ft_deq2 >= ft_deq);
+}
+
+TEST(deque, stackContainer) {
+  std::stack<std::string, std::deque<std::string> > std_sta;
+  ft::stack<std::string, ft::deque<std::string> > ft_sta;
+
+  for (int i = 0; i < 10000; i++) {
+    std_sta.push(std::string(i % 7, 'a'));
+    ft_sta.push(std::string(i % 7, 'a'));
+  }
+  while (!std_sta.empty()) {
+    EXPECT_EQ(ft_sta.top(), std_sta.top());
+    std_sta.pop();
+    ft_sta.pop();
+  }
+  EXPECT_TRUE(ft_sta.empty());
+
+  ft::stack<int, ft::deque<int> > ft_sta2;
+  ft::stack<int, ft::deque<int> > ft_sta3;
+  ft_sta2.push(1);
+  ft_sta3.push(2);
+  EXPECT_TRUE(ft_sta2 < ft_sta3);
+  EXPECT_TRUE(ft_sta2 != ft_sta3);
+}
@@ -525,3 +525,46 @@ TEST(map, key_comp) {
     EXPECT_EQ(ft_comp(i, i), std_comp(i, i));
   }
 }
+
+static long live_allocations = 0;
+
+template <class T>
+struct counting_allocator : std::allocator<T> {
+  template <class U>
+  struct rebind {
+    typedef counting_allocator<U> other;
+  };
+
+  counting_allocator() {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>&) {}
+
+  T* allocate(size_t n, const void* = 0) {
+    live_allocations += n;
+    return std::allocator<T>::allocate(n);
+  }
+
+  void deallocate(T* p, size_t n) {
+    live_allocations -= n;
+    std::allocator<T>::deallocate(p, n);
+  }
+};
+
+TEST(map, nodesGoBackToAllocator) {
+  typedef ft::map<int, int, std::less<int>,
+                  counting_allocator<ft::pair<const int, int> > >
+      counted_map;
+  {
+    counted_map map;
+    for (int i = 0; i < 100; i++) {
+      map.insert(ft::make_pair(i, i));
+    }
+    EXPECT_EQ(live_allocations, 100);
+    for (int i = 0; i < 100; i += 2) {
+      map.erase(i);
+    }
+    EXPECT_EQ(live_allocations, 50);
+  }
+  EXPECT_EQ(live_allocations, 0);
+}
@@ -0,0 +1,209 @@
+#include "priority_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <queue>
+#include <string>
+#include <vector>
+
+template <class FtQueue, class StdQueue>
+bool equal(const FtQueue& ft, const StdQueue& std) {
+  FtQueue ft_cp(ft);
+  StdQueue std_cp(std);
+  if (ft_cp.size() != std_cp.size() || ft_cp.empty() != std_cp.empty())
+    return false;
+  while (!std_cp.empty()) {
+    if (ft_cp.top() != std_cp.top()) return false;
+    ft_cp.pop();
+    std_cp.pop();
+  }
+  return ft_cp.empty();
+}
+
+TEST(priority_queue, defaultConstructor) {
+  std::priority_queue<int> std_que;
+  ft::priority_queue<int> ft_que;
+  EXPECT_TRUE(equal(ft_que, std_que));
+  EXPECT_EQ(ft::priority_queue<int>::arity, 4u);
+}
+
+TEST(priority_queue, RangeConstructor) {
+  std::list<int> lst;
+  for (int i = 0; i < 1000; i++) {
+    lst.push_back(std::rand() % 100);
+  }
+  std::priority_queue<int> std_que(lst.begin(), lst.end());
+  ft::priority_queue<int> ft_que(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_que, std_que));
+}
+
+TEST(priority_queue, pushPop) {
+  std::priority_queue<int> std_que;
+  ft::priority_queue<int> ft_que;
+
+  for (int i = 0; i < 5000; i++) {
+    int value = std::rand() % 1000;
+    std_que.push(value);
+    ft_que.push(value);
+    if (i % 3 == 0) {
+      EXPECT_EQ(ft_que.top(), std_que.top());
+      std_que.pop();
+      ft_que.pop();
+    }
+  }
+  EXPECT_TRUE(equal(ft_que, std_que));
+  ft_que.pop();
+}
+
+TEST(priority_queue, arity) {
+  std::priority_queue<int, std::vector<int>, std::greater<int> > std_que;
+  ft::priority_queue<int, ft::vector<int>, std::greater<int>, 2> ft_que2;
+  ft::priority_queue<int, ft::vector<int>, std::greater<int>, 8> ft_que8;
+
+  for (int i = 0; i < 3000; i++) {
+    int value = std::rand();
+    std_que.push(value);
+    ft_que2.push(value);
+    ft_que8.push(value);
+  }
+  EXPECT_TRUE(equal(ft_que2, std_que));
+  EXPECT_TRUE(equal(ft_que8, std_que));
+}
+
+TEST(priority_queue, strings) {
+  std::priority_queue<std::string> std_que;
+  ft::priority_queue<std::string> ft_que;
+
+  for (int i = 0; i < 500; i++) {
+    std::string value(std::rand() % 20, 'a' + std::rand() % 26);
+    std_que.push(value);
+    ft_que.push(value);
+  }
+  EXPECT_TRUE(equal(ft_que, std_que));
+}
+
+TEST(priority_queue, swap) {
+  ft::priority_queue<int> ft_que;
+  ft::priority_queue<int> ft_que2;
+  ft_que.push(1);
+  ft_que2.push(2);
+  ft_que2.push(3);
+
+  ft::swap(ft_que, ft_que2);
+  EXPECT_EQ(ft_que.size(), 2u);
+  EXPECT_EQ(ft_que.top(), 3);
+  EXPECT_EQ(ft_que2.top(), 1);
+}
+
+TEST(indexed_priority_queue, pushPop) {
+  std::priority_queue<int> std_que;
+  ft::indexed_priority_queue<int> ft_que;
+
+  for (int i = 0; i < 5000; i++) {
+    int value = std::rand() % 1000;
+    std_que.push(value);
+    ft_que.push(value);
+    if (i % 3 == 0) {
+      EXPECT_EQ(ft_que.top(), std_que.top());
+      std_que.pop();
+      ft_que.pop();
+    }
+  }
+  while (!std_que.empty()) {
+    EXPECT_EQ(ft_que.top(), std_que.top());
+    EXPECT_EQ(ft_que.value(ft_que.top_handle()), std_que.top());
+    std_que.pop();
+    ft_que.pop();
+  }
+  EXPECT_TRUE(ft_que.empty());
+}
+
+TEST(indexed_priority_queue, eraseAndUpdate) {
+  ft::indexed_priority_queue<int, std::greater<int> > ft_que;
+  std::vector<size_t> handles;
+  for (int i = 0; i < 100; i++) {
+    handles.push_back(ft_que.push(i * 10));
+  }
+
+  ft_que.erase(handles[0]);
+  EXPECT_FALSE(ft_que.contains(handles[0]));
+  EXPECT_EQ(ft_que.top(), 10);
+  EXPECT_THROW(ft_que.erase(handles[0]), std::out_of_range);
+
+  ft_que.decrease_key(handles[50], 5);
+  EXPECT_EQ(ft_que.top(), 5);
+  EXPECT_EQ(ft_que.top_handle(), handles[50]);
+
+  ft_que.update(handles[50], 2000);
+  EXPECT_EQ(ft_que.top(), 10);
+
+  size_t reused = ft_que.push(1);
+  EXPECT_EQ(reused, handles[0]);
+  EXPECT_EQ(ft_que.top(), 1);
+
+  int last = -1;
+  while (!ft_que.empty()) {
+    EXPECT_LE(last, ft_que.top());
+    last = ft_que.top();
+    ft_que.pop();
+  }
+  EXPECT_EQ(last, 2000);
+}
+
+TEST(indexed_priority_queue, dijkstra) {
+  const int n = 200;
+  std::vector<std::vector<std::pair<int, int> > > graph(n);
+  for (int u = 0; u < n; u++) {
+    for (int k = 0; k < 5; k++) {
+      graph[u].push_back(std::make_pair(std::rand() % n, std::rand() % 100));
+    }
+  }
+
+  // Reference: O(n^2) Dijkstra without a heap.
+  std::vector<int> expected(n, -1);
+  std::vector<bool> done(n, false);
+  expected[0] = 0;
+  for (int iter = 0; iter < n; iter++) {
+    int u = -1;
+    for (int v = 0; v < n; v++) {
+      if (!done[v] && expected[v] >= 0 && (u < 0 || expected[v] < expected[u]))
+        u = v;
+    }
+    if (u < 0) break;
+    done[u] = true;
+    for (size_t e = 0; e < graph[u].size(); e++) {
+      int v = graph[u][e].first;
+      int d = expected[u] + graph[u][e].second;
+      if (expected[v] < 0 || d < expected[v]) expected[v] = d;
+    }
+  }
+
+  typedef std::pair<int, int> entry;  // (distance, vertex)
+  ft::indexed_priority_queue<entry, std::greater<entry> > que;
+  std::vector<int> dist(n, -1);
+  std::vector<size_t> handle(n);
+  std::vector<bool> queued(n, false);
+  dist[0] = 0;
+  handle[0] = que.push(entry(0, 0));
+  queued[0] = true;
+  while (!que.empty()) {
+    int u = que.top().second;
+    que.pop();
+    for (size_t e = 0; e < graph[u].size(); e++) {
+      int v = graph[u][e].first;
+      int d = dist[u] + graph[u][e].second;
+      if (dist[v] >= 0 && d >= dist[v]) continue;
+      dist[v] = d;
+      if (queued[v] && que.contains(handle[v])) {
+        que.decrease_key(handle[v], entry(d, v));
+      } else if (!queued[v]) {
+        handle[v] = que.push(entry(d, v));
+        queued[v] = true;
+      }
+    }
+  }
+  EXPECT_EQ(dist, expected);
+}
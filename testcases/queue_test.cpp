@@ -0,0 +1,118 @@
+#include "queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <queue>
+#include <string>
+
+#include "deque.hpp"
+
+template <class T, class C>
+bool equal(const ft::queue<T, C>& ft, const std::queue<T>& std) {
+  ft::queue<T, C> ft_cp(ft);
+  std::queue<T> std_cp(std);
+  if (ft_cp.size() != std_cp.size() || ft_cp.empty() != std_cp.empty())
+    return false;
+  while (ft_cp.size() && std_cp.size()) {
+    if (ft_cp.front() != std_cp.front() || ft_cp.back() != std_cp.back()) {
+      return false;
+    }
+    ft_cp.pop();
+    std_cp.pop();
+  }
+
+  return true;
+}
+
+TEST(queue, defaultConstructor) {
+  std::queue<int> std_que;
+  ft::queue<int> ft_que;
+  EXPECT_TRUE(equal(ft_que, std_que));
+}
+
+TEST(queue, empty) {
+  std::queue<int> std_que;
+  ft::queue<int> ft_que;
+
+  EXPECT_EQ(ft_que.empty(), std_que.empty());
+  std_que.push(1);
+  ft_que.push(1);
+  EXPECT_EQ(ft_que.empty(), std_que.empty());
+  EXPECT_TRUE(equal(ft_que, std_que));
+}
+
+TEST(queue, frontBack) {
+  std::queue<int> std_que;
+  ft::queue<int> ft_que;
+
+  for (int i = 0; i < 3; i++) {
+    std_que.push(i);
+    ft_que.push(i);
+    EXPECT_EQ(ft_que.front(), std_que.front());
+    EXPECT_EQ(ft_que.back(), std_que.back());
+  }
+
+  const ft::queue<int> ft_que_cp(ft_que);
+  EXPECT_EQ(ft_que_cp.front(), std_que.front());
+  EXPECT_EQ(ft_que_cp.back(), std_que.back());
+}
+
+TEST(queue, pushPop) {
+  std::queue<std::string> std_que;
+  ft::queue<std::string> ft_que;
+
+  for (size_t i = 0; i < 1000; i++) {
+    std_que.push(std::string(i % 13, 'x'));
+    ft_que.push(std::string(i % 13, 'x'));
+    if (i % 3 == 0) {
+      std_que.pop();
+      ft_que.pop();
+    }
+  }
+  EXPECT_TRUE(equal(ft_que, std_que));
+
+  while (!std_que.empty()) {
+    std_que.pop();
+    ft_que.pop();
+    EXPECT_EQ(ft_que.size(), std_que.size());
+  }
+  EXPECT_TRUE(ft_que.empty());
+}
+
+TEST(queue, dequeContainer) {
+  std::queue<int> std_que;
+  ft::queue<int, ft::deque<int> > ft_que;
+
+  for (size_t i = 0; i < 10000; i++) {
+    std_que.push(i);
+    ft_que.push(i);
+    if (i % 2 == 0) {
+      std_que.pop();
+      ft_que.pop();
+    }
+  }
+  EXPECT_TRUE(equal(ft_que, std_que));
+}
+
+TEST(queue, RelationalOperator) {
+  ft::queue<int> ft_que;
+  ft::queue<int> ft_que2;
+
+  for (size_t i = 0; i < 1000; i++) {
+    ft_que.push(i);
+    ft_que2.push(i);
+  }
+
+  ft_que2.push(100000);
+
+  EXPECT_TRUE(ft_que == ft_que);
+  EXPECT_TRUE(ft_que != ft_que2);
+  EXPECT_TRUE(ft_que < ft_que2);
+  EXPECT_TRUE(ft_que2 > ft_que);
+  EXPECT_TRUE(ft_que <= ft_que2);
+  EXPECT_TRUE(ft_que2 >= ft_que);
+  EXPECT_TRUE(ft_que <= ft_que);
+  EXPECT_TRUE(ft_que >= ft_que);
+}
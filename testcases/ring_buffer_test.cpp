@@ -0,0 +1,192 @@
+#include "ring_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <memory>
+#include <string>
+
+template <class T>
+bool equal(const ft::ring_buffer<T>& ft, const std::deque<T>& std) {
+  if (ft.size() != std.size() || ft.empty() != std.empty()) return false;
+  for (size_t i = 0; i < ft.size(); i++) {
+    if (ft[i] != std[i]) return false;
+  }
+  return true;
+}
+
+TEST(ring_buffer, defaultConstructor) {
+  std::deque<int> std_deq;
+  ft::ring_buffer<int> ft_buf;
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+  EXPECT_EQ(ft_buf.capacity(), 0u);
+  EXPECT_TRUE(ft_buf.begin() == ft_buf.end());
+}
+
+TEST(ring_buffer, FillConstructor) {
+  std::deque<int> std_deq(100, 10);
+  ft::ring_buffer<int> ft_buf(100, 10);
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+  EXPECT_EQ(ft_buf.capacity(), 128u);
+}
+
+TEST(ring_buffer, RangeConstructor) {
+  std::list<int> lst;
+  for (size_t i = 0; i < 100; i++) {
+    lst.push_back(i);
+  }
+
+  std::deque<int> std_deq(lst.begin(), lst.end());
+  ft::ring_buffer<int> ft_buf(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+}
+
+TEST(ring_buffer, CopyConstructor) {
+  std::deque<std::string> std_deq(10, "hello");
+  ft::ring_buffer<std::string> ft_buf(10, "hello");
+  ft::ring_buffer<std::string> ft_buf2(ft_buf);
+  EXPECT_TRUE(equal(ft_buf2, std_deq));
+}
+
+TEST(ring_buffer, reserve) {
+  ft::ring_buffer<int> ft_buf;
+  ft_buf.reserve(5);
+  EXPECT_EQ(ft_buf.capacity(), 8u);
+  ft_buf.reserve(9);
+  EXPECT_EQ(ft_buf.capacity(), 16u);
+  ft_buf.reserve(3);
+  EXPECT_EQ(ft_buf.capacity(), 16u);
+  EXPECT_THROW(ft_buf.reserve(ft_buf.max_size() + 1), std::length_error);
+}
+
+TEST(ring_buffer, wrapAround) {
+  std::deque<int> std_deq;
+  ft::ring_buffer<int> ft_buf;
+  ft_buf.reserve(8);
+
+  for (int i = 0; i < 1000; i++) {
+    std_deq.push_back(i);
+    ft_buf.push_back(i);
+    if (std_deq.size() > 5) {
+      std_deq.pop_front();
+      ft_buf.pop_front();
+    }
+    EXPECT_TRUE(equal(ft_buf, std_deq));
+  }
+  EXPECT_EQ(ft_buf.capacity(), 8u);
+}
+
+TEST(ring_buffer, growWhileWrapped) {
+  std::deque<std::string> std_deq;
+  ft::ring_buffer<std::string> ft_buf;
+
+  for (int i = 0; i < 6; i++) {
+    std_deq.push_back("a");
+    ft_buf.push_back("a");
+  }
+  for (int i = 0; i < 4; i++) {
+    std_deq.pop_front();
+    ft_buf.pop_front();
+  }
+  for (int i = 0; i < 100; i++) {
+    std_deq.push_back(std::string(i % 5, 'b'));
+    ft_buf.push_back(std::string(i % 5, 'b'));
+  }
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+
+  ft_buf.push_back(ft_buf.front());
+  std_deq.push_back(std_deq.front());
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+}
+
+TEST(ring_buffer, pushFrontPopBack) {
+  std::deque<int> std_deq;
+  ft::ring_buffer<int> ft_buf;
+
+  for (int i = 0; i < 100; i++) {
+    std_deq.push_front(i);
+    ft_buf.push_front(i);
+    std_deq.push_back(-i);
+    ft_buf.push_back(-i);
+  }
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+
+  for (int i = 0; i < 50; i++) {
+    std_deq.pop_back();
+    ft_buf.pop_back();
+  }
+  EXPECT_TRUE(equal(ft_buf, std_deq));
+  EXPECT_EQ(ft_buf.front(), std_deq.front());
+  EXPECT_EQ(ft_buf.back(), std_deq.back());
+
+  ft_buf.clear();
+  ft_buf.pop_back();
+  ft_buf.pop_front();
+  EXPECT_TRUE(ft_buf.empty());
+}
+
+TEST(ring_buffer, iterator) {
+  std::deque<int> std_deq;
+  ft::ring_buffer<int> ft_buf;
+  ft_buf.reserve(16);
+  for (int i = 0; i < 12; i++) {
+    std_deq.push_back(i);
+    ft_buf.push_back(i);
+  }
+  for (int i = 0; i < 8; i++) {
+    std_deq.pop_front();
+    ft_buf.pop_front();
+    std_deq.push_back(i + 100);
+    ft_buf.push_back(i + 100);
+  }
+
+  ft::ring_buffer<int>::iterator it = ft_buf.begin();
+  ft::ring_buffer<int>::const_iterator cit = it;
+  EXPECT_TRUE(cit == it);
+  EXPECT_EQ(ft_buf.end() - ft_buf.begin(), 12);
+  EXPECT_EQ(it[9], std_deq[9]);
+  EXPECT_EQ(*(it + 10), std_deq[10]);
+
+  std::deque<int>::reverse_iterator std_rit = std_deq.rbegin();
+  for (ft::ring_buffer<int>::reverse_iterator rit = ft_buf.rbegin();
+       rit != ft_buf.rend(); ++rit, ++std_rit) {
+    EXPECT_EQ(*rit, *std_rit);
+  }
+}
+
+TEST(ring_buffer, at) {
+  ft::ring_buffer<int> ft_buf(10, 1);
+  const ft::ring_buffer<int> cft_buf(10, 1);
+  EXPECT_EQ(ft_buf.at(9), 1);
+  EXPECT_EQ(cft_buf.at(9), 1);
+  EXPECT_THROW(ft_buf.at(10), std::out_of_range);
+  EXPECT_THROW(cft_buf.at(10), std::out_of_range);
+}
+
+TEST(ring_buffer, swap) {
+  ft::ring_buffer<int> ft_buf(2, 1);
+  ft::ring_buffer<int> ft_buf2(100, 2);
+  ft::ring_buffer<int> ft_cp = ft_buf;
+  ft::ring_buffer<int> ft_cp2 = ft_buf2;
+
+  ft_buf.swap(ft_buf2);
+  EXPECT_EQ(ft_buf, ft_cp2);
+  EXPECT_EQ(ft_buf2, ft_cp);
+
+  ft::swap(ft_buf, ft_buf2);
+  EXPECT_EQ(ft_buf, ft_cp);
+  EXPECT_EQ(ft_buf2, ft_cp2);
+}
+
+TEST(ring_buffer, relationalOperator) {
+  ft::ring_buffer<int> ft_buf(3, 1);
+  ft::ring_buffer<int> ft_buf2(3, 2);
+
+  EXPECT_TRUE(ft_buf == ft_buf);
+  EXPECT_TRUE(ft_buf != ft_buf2);
+  EXPECT_TRUE(ft_buf < ft_buf2);
+  EXPECT_TRUE(ft_buf2 > ft_buf);
+  EXPECT_TRUE(ft_buf <= ft_buf2);
+  EXPECT_TRUE(ft_buf2 >= ft_buf);
+}
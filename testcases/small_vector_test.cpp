@@ -0,0 +1,188 @@
+#include "small_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+template <class T, std::size_t N>
+bool equal(const ft::small_vector<T, N>& ft, const std::vector<T>& std) {
+  if (ft.size() != std.size() || ft.empty() != std.empty()) return false;
+  for (size_t i = 0; i < ft.size(); i++) {
+    if (ft[i] != std[i]) return false;
+  }
+  return true;
+}
+
+TEST(small_vector, defaultConstructor) {
+  std::vector<int> std_vec;
+  ft::small_vector<int, 8> ft_vec;
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(ft_vec.capacity(), 8u);
+  EXPECT_TRUE(ft_vec.is_inline());
+}
+
+TEST(small_vector, FillConstructor) {
+  std::vector<int> std_vec(5, 10);
+  ft::small_vector<int, 8> ft_vec(5, 10);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_TRUE(ft_vec.is_inline());
+
+  std::vector<int> std_vec2(100, 10);
+  ft::small_vector<int, 8> ft_vec2(100, 10);
+  EXPECT_TRUE(equal(ft_vec2, std_vec2));
+  EXPECT_FALSE(ft_vec2.is_inline());
+}
+
+TEST(small_vector, RangeConstructor) {
+  std::list<int> lst;
+  for (size_t i = 0; i < 100; i++) {
+    lst.push_back(i);
+  }
+
+  std::vector<int> std_vec(lst.begin(), lst.end());
+  ft::small_vector<int, 8> ft_vec(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, CopyConstructor) {
+  std::list<int> lst;
+  for (size_t i = 0; i < 4; i++) {
+    lst.push_back(i);
+  }
+
+  std::vector<int> std_vec(lst.begin(), lst.end());
+  ft::small_vector<int, 8> ft_vec(lst.begin(), lst.end());
+  ft::small_vector<int, 8> ft_vec2(ft_vec);
+  EXPECT_TRUE(equal(ft_vec2, std_vec));
+  EXPECT_TRUE(ft_vec2.is_inline());
+  EXPECT_NE(&ft_vec[0], &ft_vec2[0]);
+}
+
+TEST(small_vector, push_backSpill) {
+  std::vector<std::string> std_vec;
+  ft::small_vector<std::string, 4> ft_vec;
+
+  for (size_t i = 0; i < 4; i++) {
+    std_vec.push_back("hello");
+    ft_vec.push_back("hello");
+  }
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_TRUE(ft_vec.is_inline());
+
+  std_vec.push_back("world");
+  ft_vec.push_back("world");
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_FALSE(ft_vec.is_inline());
+
+  ft_vec.push_back(ft_vec[0]);
+  std_vec.push_back(std_vec[0]);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, pop_back) {
+  std::vector<int> std_vec(3, 1);
+  ft::small_vector<int, 4> ft_vec(3, 1);
+
+  std_vec.pop_back();
+  ft_vec.pop_back();
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, resize) {
+  std::vector<int> std_vec;
+  ft::small_vector<int, 4> ft_vec;
+
+  std_vec.resize(3, 7);
+  ft_vec.resize(3, 7);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.resize(20, 5);
+  ft_vec.resize(20, 5);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.resize(2);
+  ft_vec.resize(2);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, insert) {
+  std::vector<int> std_vec(3, 1);
+  ft::small_vector<int, 4> ft_vec(3, 1);
+
+  std::vector<int>::iterator std_it = std_vec.insert(std_vec.begin() + 1, 2);
+  ft::small_vector<int, 4>::iterator ft_it =
+      ft_vec.insert(ft_vec.begin() + 1, 2);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(*ft_it, *std_it);
+
+  std_it = std_vec.insert(std_vec.begin(), 3);
+  ft_it = ft_vec.insert(ft_vec.begin(), 3);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(*ft_it, *std_it);
+
+  std_vec.insert(std_vec.end(), 10, 4);
+  ft_vec.insert(ft_vec.end(), 10, 4);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::list<int> lst(5, 9);
+  std_vec.insert(std_vec.begin() + 2, lst.begin(), lst.end());
+  ft_vec.insert(ft_vec.begin() + 2, lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, erase) {
+  std::vector<int> std_vec;
+  ft::small_vector<int, 4> ft_vec;
+  for (int i = 0; i < 10; i++) {
+    std_vec.push_back(i);
+    ft_vec.push_back(i);
+  }
+
+  std_vec.erase(std_vec.begin() + 3);
+  ft_vec.erase(ft_vec.begin() + 3);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.erase(std_vec.begin(), std_vec.begin() + 4);
+  ft_vec.erase(ft_vec.begin(), ft_vec.begin() + 4);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.clear();
+  ft_vec.clear();
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(small_vector, swap) {
+  ft::small_vector<int, 4> inline_vec(2, 1);
+  ft::small_vector<int, 4> heap_vec(10, 2);
+  ft::small_vector<int, 4> inline_cp = inline_vec;
+  ft::small_vector<int, 4> heap_cp = heap_vec;
+
+  inline_vec.swap(heap_vec);
+  EXPECT_EQ(inline_vec, heap_cp);
+  EXPECT_EQ(heap_vec, inline_cp);
+
+  ft::swap(inline_vec, heap_vec);
+  EXPECT_EQ(inline_vec, inline_cp);
+  EXPECT_EQ(heap_vec, heap_cp);
+
+  ft::small_vector<int, 4> heap_vec2(20, 3);
+  ft::small_vector<int, 4> heap_cp2 = heap_vec2;
+  heap_vec.swap(heap_vec2);
+  EXPECT_EQ(heap_vec, heap_cp2);
+  EXPECT_EQ(heap_vec2, heap_cp);
+}
+
+TEST(small_vector, relationalOperator) {
+  ft::small_vector<int, 4> ft_vec(3, 1);
+  ft::small_vector<int, 4> ft_vec2(3, 2);
+
+  EXPECT_TRUE(ft_vec == ft_vec);
+  EXPECT_TRUE(ft_vec != ft_vec2);
+  EXPECT_TRUE(ft_vec < ft_vec2);
+  EXPECT_TRUE(ft_vec2 > ft_vec);
+  EXPECT_TRUE(ft_vec <= ft_vec2);
+  EXPECT_TRUE(ft_vec2 >= ft_vec);
+}
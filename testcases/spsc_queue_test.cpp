@@ -0,0 +1,113 @@
+#include "spsc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(spsc_queue, capacity) {
+  ft::spsc_queue<int> queue(100);
+  EXPECT_EQ(queue.capacity(), 128u);
+  EXPECT_TRUE(queue.empty());
+
+  ft::spsc_queue<int> queue2(64);
+  EXPECT_EQ(queue2.capacity(), 64u);
+}
+
+TEST(spsc_queue, pushPop) {
+  ft::spsc_queue<std::string> queue(4);
+  std::string out;
+
+  EXPECT_FALSE(queue.try_pop(out));
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_push(std::string(i + 1, 'a')));
+  }
+  EXPECT_FALSE(queue.try_push("full"));
+  EXPECT_EQ(queue.size(), 4u);
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out, std::string(i + 1, 'a'));
+  }
+  EXPECT_FALSE(queue.try_pop(out));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, wrapAround) {
+  ft::spsc_queue<int> queue(8);
+  int next_push = 0;
+  int next_pop = 0;
+  int out;
+
+  for (int round = 0; round < 200; round++) {
+    for (int i = 0; i < 5; i++) {
+      queue.push(next_push++);
+    }
+    for (int i = 0; i < 5; i++) {
+      queue.pop(out);
+      EXPECT_EQ(out, next_pop++);
+    }
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, batch) {
+  ft::spsc_queue<int> queue(16);
+  std::list<int> lst;
+  for (int i = 0; i < 20; i++) {
+    lst.push_back(i);
+  }
+
+  EXPECT_EQ(queue.try_push_n(lst.begin(), 20), 16u);
+  EXPECT_EQ(queue.try_push_n(lst.begin(), 20), 0u);
+
+  std::vector<int> out(10);
+  EXPECT_EQ(queue.try_pop_n(out.begin(), 10), 10u);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(out[i], i);
+  }
+  EXPECT_EQ(queue.try_push_n(lst.begin(), 3), 3u);
+
+  std::vector<int> rest;
+  EXPECT_EQ(queue.try_pop_n(std::back_inserter(rest), 100), 9u);
+  EXPECT_EQ(rest[5], 15);
+  EXPECT_EQ(rest[6], 0);
+  EXPECT_EQ(rest[8], 2);
+  EXPECT_EQ(queue.try_pop_n(out.begin(), 10), 0u);
+}
+
+TEST(spsc_queue, destroyRemaining) {
+  ft::spsc_queue<std::string> queue(8);
+  queue.push(std::string(100, 'a'));
+  queue.push(std::string(100, 'b'));
+}
+
+TEST(spsc_queue, twoThreads) {
+  const size_t messages = 200000;
+  ft::spsc_queue<size_t> queue(64);
+  size_t checksum = 0;
+  bool ordered = true;
+
+  std::thread consumer([&]() {
+    size_t expected = 0;
+    size_t buf[16];
+    while (expected < messages) {
+      size_t n = queue.try_pop_n(buf, 16);
+      for (size_t i = 0; i < n; i++, expected++) {
+        if (buf[i] != expected) ordered = false;
+        checksum += buf[i];
+      }
+      if (n == 0) std::this_thread::yield();
+    }
+  });
+  for (size_t i = 0; i < messages; i++) {
+    queue.push(i);
+  }
+  consumer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(checksum, messages * (messages - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
@@ -2,9 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <stack>
+#include <string>
+
+#include "deque.hpp"
 
 template <class T>
 bool equal(const ft::stack<T>& ft, const std::stack<T>& std) {
@@ -156,3 +161,79 @@ TEST(stack, RelationalOperator) {
   EXPECT_TRUE(ft_sta <= ft_sta);
   EXPECT_TRUE(ft_sta >= ft_sta);
 }
+
+TEST(stack, emplace) {
+  std::stack<std::string> std_sta;
+  ft::stack<std::string> ft_sta;
+
+  std_sta.push(std::string());
+  ft_sta.emplace();
+  std_sta.push(std::string("hello"));
+  ft_sta.emplace("hello");
+  std_sta.push(std::string(3, 'a'));
+  ft_sta.emplace(3, 'a');
+  std_sta.push(std::string("hello", 1, 3));
+  ft_sta.emplace("hello", 1, 3);
+  EXPECT_TRUE(equal(ft_sta, std_sta));
+}
+
+TEST(stack, pushRange) {
+  std::stack<int> std_sta;
+  ft::stack<int> ft_sta;
+  std::list<int> lst;
+  for (int i = 0; i < 100; i++) {
+    lst.push_back(i);
+  }
+
+  for (std::list<int>::iterator it = lst.begin(); it != lst.end(); ++it) {
+    std_sta.push(*it);
+  }
+  ft_sta.push_range(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_sta, std_sta));
+  EXPECT_EQ(ft_sta.top(), 99);
+
+  std::istringstream iss("1 2 3");
+  ft_sta.push_range(std::istream_iterator<int>(iss),
+                    std::istream_iterator<int>());
+  std_sta.push(1);
+  std_sta.push(2);
+  std_sta.push(3);
+  EXPECT_TRUE(equal(ft_sta, std_sta));
+}
+
+TEST(stack, popN) {
+  std::stack<int> std_sta;
+  ft::stack<int> ft_sta;
+  for (int i = 0; i < 100; i++) {
+    std_sta.push(i);
+    ft_sta.push(i);
+  }
+
+  for (int i = 0; i < 30; i++) {
+    std_sta.pop();
+  }
+  ft_sta.pop_n(30);
+  EXPECT_TRUE(equal(ft_sta, std_sta));
+
+  ft_sta.pop_n(0);
+  EXPECT_TRUE(equal(ft_sta, std_sta));
+
+  ft_sta.pop_n(1000);
+  EXPECT_TRUE(ft_sta.empty());
+}
+
+TEST(stack, reserve) {
+  EXPECT_TRUE(ft::has_reserve<ft::vector<int> >::value);
+  EXPECT_FALSE(ft::has_reserve<ft::deque<int> >::value);
+
+  ft::stack<int> ft_sta;
+  ft_sta.reserve(100);
+  ft_sta.push(1);
+  EXPECT_EQ(ft_sta.top(), 1);
+
+  ft::stack<int, ft::deque<int> > ft_sta2;
+  ft_sta2.reserve(100);
+  ft_sta2.push(1);
+  ft_sta2.pop_n(1);
+  EXPECT_TRUE(ft_sta2.empty());
+}
@@ -0,0 +1,140 @@
+#include "static_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "stack.hpp"
+
+template <class T, std::size_t N>
+bool equal(const ft::static_vector<T, N>& ft, const std::vector<T>& std) {
+  if (ft.size() != std.size() || ft.empty() != std.empty()) return false;
+  for (size_t i = 0; i < ft.size(); i++) {
+    if (ft[i] != std[i]) return false;
+  }
+  return true;
+}
+
+TEST(static_vector, defaultConstructor) {
+  std::vector<int> std_vec;
+  ft::static_vector<int, 16> ft_vec;
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(ft_vec.capacity(), 16u);
+  EXPECT_EQ(ft_vec.max_size(), 16u);
+}
+
+TEST(static_vector, RangeConstructor) {
+  std::list<int> lst;
+  for (size_t i = 0; i < 10; i++) {
+    lst.push_back(i);
+  }
+
+  std::vector<int> std_vec(lst.begin(), lst.end());
+  ft::static_vector<int, 16> ft_vec(lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  ft::static_vector<int, 16> ft_vec2(ft_vec);
+  EXPECT_TRUE(equal(ft_vec2, std_vec));
+}
+
+TEST(static_vector, push_back) {
+  std::vector<std::string> std_vec;
+  ft::static_vector<std::string, 4> ft_vec;
+
+  for (size_t i = 0; i < 4; i++) {
+    std_vec.push_back("hello");
+    ft_vec.push_back("hello");
+  }
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_THROW(ft_vec.push_back("world"), std::length_error);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.pop_back();
+  ft_vec.pop_back();
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(static_vector, insert) {
+  std::vector<int> std_vec(3, 1);
+  ft::static_vector<int, 16> ft_vec(3, 1);
+
+  std_vec.insert(std_vec.begin() + 1, 2);
+  ft_vec.insert(ft_vec.begin() + 1, 2);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.insert(std_vec.begin(), 5, 4);
+  ft_vec.insert(ft_vec.begin(), 5, 4);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  EXPECT_THROW(ft_vec.insert(ft_vec.begin(), 10, 0), std::length_error);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_THROW(ft_vec.reserve(17), std::length_error);
+}
+
+TEST(static_vector, erase) {
+  std::vector<int> std_vec;
+  ft::static_vector<int, 16> ft_vec;
+  for (int i = 0; i < 10; i++) {
+    std_vec.push_back(i);
+    ft_vec.push_back(i);
+  }
+
+  std_vec.erase(std_vec.begin() + 3);
+  ft_vec.erase(ft_vec.begin() + 3);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.erase(std_vec.begin(), std_vec.begin() + 4);
+  ft_vec.erase(ft_vec.begin(), ft_vec.begin() + 4);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.resize(1);
+  ft_vec.resize(1);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.clear();
+  ft_vec.clear();
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(static_vector, swap) {
+  ft::static_vector<int, 16> ft_vec(2, 1);
+  ft::static_vector<int, 16> ft_vec2(10, 2);
+  ft::static_vector<int, 16> ft_vec_cp = ft_vec;
+  ft::static_vector<int, 16> ft_vec2_cp = ft_vec2;
+
+  ft::swap(ft_vec, ft_vec2);
+  EXPECT_EQ(ft_vec, ft_vec2_cp);
+  EXPECT_EQ(ft_vec2, ft_vec_cp);
+}
+
+TEST(static_vector, relationalOperator) {
+  ft::static_vector<int, 4> ft_vec(3, 1);
+  ft::static_vector<int, 4> ft_vec2(3, 2);
+
+  EXPECT_TRUE(ft_vec == ft_vec);
+  EXPECT_TRUE(ft_vec != ft_vec2);
+  EXPECT_TRUE(ft_vec < ft_vec2);
+  EXPECT_TRUE(ft_vec2 > ft_vec);
+  EXPECT_TRUE(ft_vec <= ft_vec2);
+  EXPECT_TRUE(ft_vec2 >= ft_vec);
+}
+
+TEST(static_vector, stackContainer) {
+  ft::stack<int, ft::static_vector<int, 8> > ft_sta;
+  ft::stack<int, ft::static_vector<int, 8> > ft_sta2;
+
+  for (int i = 0; i < 8; i++) {
+    ft_sta.push(i);
+    ft_sta2.push(i);
+  }
+  EXPECT_EQ(ft_sta.size(), 8u);
+  EXPECT_EQ(ft_sta.top(), 7);
+  EXPECT_TRUE(ft_sta == ft_sta2);
+
+  ft_sta.pop();
+  EXPECT_EQ(ft_sta.top(), 6);
+  EXPECT_TRUE(ft_sta < ft_sta2);
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+#include "stack.hpp"
+#include "vector.hpp"
+
+bool equal(const ft::vector<bool>& ft, const std::vector<bool>& std) {
+  if (ft.size() != std.size() || ft.empty() != std.empty()) return false;
+  for (size_t i = 0; i < ft.size(); i++) {
+    if (ft[i] != std[i]) return false;
+  }
+  return true;
+}
+
+TEST(vector_bool, packedStorage) {
+  ft::vector<bool> ft_vec(1000, true);
+  EXPECT_EQ(ft_vec.size(), 1000u);
+  EXPECT_EQ(ft_vec.capacity() % (sizeof(unsigned long) * 8), 0u);
+  EXPECT_LT(ft_vec.capacity(), 1000u + sizeof(unsigned long) * 8);
+  EXPECT_EQ(ft_vec.count(), 1000u);
+}
+
+TEST(vector_bool, push_back) {
+  std::vector<bool> std_vec;
+  ft::vector<bool> ft_vec;
+
+  for (size_t i = 0; i < 300; i++) {
+    std_vec.push_back(i % 3 == 0);
+    ft_vec.push_back(i % 3 == 0);
+  }
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  for (size_t i = 0; i < 100; i++) {
+    std_vec.pop_back();
+    ft_vec.pop_back();
+  }
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(ft_vec.count(), 67u);
+}
+
+TEST(vector_bool, reference) {
+  ft::vector<bool> ft_vec(10);
+  ft_vec[3] = true;
+  ft_vec[4] = ft_vec[3];
+  ft_vec.back() = true;
+  ft_vec.front().flip();
+
+  EXPECT_TRUE(ft_vec[0]);
+  EXPECT_TRUE(ft_vec[3]);
+  EXPECT_TRUE(ft_vec[4]);
+  EXPECT_TRUE(ft_vec.at(9));
+  EXPECT_FALSE(ft_vec.at(1));
+  EXPECT_THROW(ft_vec.at(10), std::out_of_range);
+
+  ft::vector<bool>::swap(ft_vec[0], ft_vec[1]);
+  EXPECT_FALSE(ft_vec[0]);
+  EXPECT_TRUE(ft_vec[1]);
+}
+
+TEST(vector_bool, iterator) {
+  std::vector<bool> std_vec;
+  for (size_t i = 0; i < 200; i++) {
+    std_vec.push_back(i % 5 == 1);
+  }
+  ft::vector<bool> ft_vec(std_vec.begin(), std_vec.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::vector<bool>::iterator std_it = std_vec.begin();
+  for (ft::vector<bool>::iterator it = ft_vec.begin(); it != ft_vec.end();
+       ++it, ++std_it) {
+    EXPECT_EQ(bool(*it), bool(*std_it));
+  }
+  EXPECT_EQ(ft_vec.end() - ft_vec.begin(), 200);
+  EXPECT_EQ(*(ft_vec.begin() + 131), std_vec[131]);
+  EXPECT_EQ(*(ft_vec.end() - 69), std_vec[131]);
+
+  std::vector<bool>::reverse_iterator std_rit = std_vec.rbegin();
+  for (ft::vector<bool>::const_reverse_iterator rit = ft_vec.rbegin();
+       rit != ft_vec.rend(); ++rit, ++std_rit) {
+    EXPECT_EQ(*rit, bool(*std_rit));
+  }
+}
+
+TEST(vector_bool, resize) {
+  std::vector<bool> std_vec;
+  ft::vector<bool> ft_vec;
+
+  std_vec.resize(70, true);
+  ft_vec.resize(70, true);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.resize(10);
+  ft_vec.resize(10);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.resize(200, false);
+  ft_vec.resize(200, false);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+  EXPECT_EQ(ft_vec.count(), 10u);
+}
+
+TEST(vector_bool, insertErase) {
+  std::vector<bool> std_vec(100, false);
+  ft::vector<bool> ft_vec(100, false);
+
+  std_vec.insert(std_vec.begin() + 10, 70, true);
+  ft_vec.insert(ft_vec.begin() + 10, 70, true);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.insert(std_vec.begin() + 1, true);
+  ft_vec.insert(ft_vec.begin() + 1, true);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::list<bool> lst(5, true);
+  std_vec.insert(std_vec.end(), lst.begin(), lst.end());
+  ft_vec.insert(ft_vec.end(), lst.begin(), lst.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.erase(std_vec.begin() + 5, std_vec.begin() + 50);
+  ft_vec.erase(ft_vec.begin() + 5, ft_vec.begin() + 50);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.erase(std_vec.begin());
+  ft_vec.erase(ft_vec.begin());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(vector_bool, bitOperations) {
+  ft::vector<bool> ft_vec(130);
+  EXPECT_EQ(ft_vec.find_first(), ft_vec.size());
+
+  ft_vec.set(65).set(129);
+  EXPECT_EQ(ft_vec.find_first(), 65u);
+  EXPECT_EQ(ft_vec.find_next(65), 129u);
+  EXPECT_EQ(ft_vec.find_next(129), ft_vec.size());
+
+  ft_vec.set();
+  EXPECT_EQ(ft_vec.count(), 130u);
+  ft_vec.reset(0);
+  EXPECT_EQ(ft_vec.count(), 129u);
+  ft_vec.flip();
+  EXPECT_EQ(ft_vec.count(), 1u);
+  ft_vec.reset();
+  EXPECT_EQ(ft_vec.count(), 0u);
+
+  ft::vector<bool> lhs(100);
+  ft::vector<bool> rhs(100);
+  for (size_t i = 0; i < 100; i++) {
+    lhs[i] = i % 2 == 0;
+    rhs[i] = i % 3 == 0;
+  }
+  ft::vector<bool> and_vec(lhs);
+  and_vec &= rhs;
+  ft::vector<bool> or_vec(lhs);
+  or_vec |= rhs;
+  ft::vector<bool> xor_vec(lhs);
+  xor_vec ^= rhs;
+  for (size_t i = 0; i < 100; i++) {
+    EXPECT_EQ(and_vec[i], lhs[i] && rhs[i]);
+    EXPECT_EQ(or_vec[i], lhs[i] || rhs[i]);
+    EXPECT_EQ(xor_vec[i], lhs[i] != rhs[i]);
+  }
+  EXPECT_THROW(lhs &= ft::vector<bool>(3), std::invalid_argument);
+}
+
+TEST(vector_bool, relationalOperator) {
+  ft::vector<bool> ft_vec(100, false);
+  ft::vector<bool> ft_vec2(100, false);
+  EXPECT_TRUE(ft_vec == ft_vec2);
+
+  ft_vec2[99] = true;
+  EXPECT_TRUE(ft_vec != ft_vec2);
+  EXPECT_TRUE(ft_vec < ft_vec2);
+  EXPECT_TRUE(ft_vec2 > ft_vec);
+
+  ft_vec2.pop_back();
+  EXPECT_TRUE(ft_vec != ft_vec2);
+  EXPECT_TRUE(ft_vec2 < ft_vec);
+
+  ft_vec = ft_vec2;
+  EXPECT_TRUE(ft_vec == ft_vec2);
+  ft_vec.swap(ft_vec2);
+  EXPECT_TRUE(ft_vec == ft_vec2);
+}
+
+TEST(vector_bool, stackContainer) {
+  ft::stack<bool> ft_sta;
+  ft_sta.push(true);
+  ft_sta.push(false);
+  EXPECT_FALSE(ft_sta.top());
+  ft_sta.top() = true;
+  EXPECT_TRUE(ft_sta.top());
+  ft_sta.pop();
+  EXPECT_EQ(ft_sta.size(), 1u);
+}
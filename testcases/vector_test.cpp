@@ -2,8 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
 #include <list>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 template <class T>
@@ -314,6 +317,41 @@ TEST(vector, resize) {
   ft_vec2.resize(1000, 10);
 }
 
+TEST(vector, resizeDefaultInit) {
+  ft::vector<char> ft_buf;
+  ft_buf.resize_default_init(64);
+  EXPECT_EQ(ft_buf.size(), 64u);
+  for (size_t i = 0; i < ft_buf.size(); i++) {
+    ft_buf[i] = 'a' + (i % 26);
+  }
+
+  ft_buf.resize_default_init(128);
+  EXPECT_EQ(ft_buf.size(), 128u);
+  for (size_t i = 0; i < 64; i++) {
+    EXPECT_EQ(ft_buf[i], 'a' + (char)(i % 26));
+  }
+
+  ft_buf.resize_default_init(10);
+  EXPECT_EQ(ft_buf.size(), 10u);
+
+  std::vector<std::string> std_vec(3, "hello");
+  ft::vector<std::string> ft_vec(3, "hello");
+  std_vec.resize(10);
+  ft_vec.resize_default_init(10);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(vector, appendUninitialized) {
+  const char src[] = "hello world";
+  ft::vector<char> ft_buf(2, '>');
+
+  char* dst = ft_buf.append_uninitialized(sizeof(src));
+  std::copy(src, src + sizeof(src), dst);
+
+  EXPECT_EQ(ft_buf.size(), 2 + sizeof(src));
+  EXPECT_EQ(std::string(&ft_buf[0]), ">>hello world");
+}
+
 TEST(vector, empty) {
   std::list<int> lst;
   for (size_t i = 0; i < 100; i++) {
@@ -698,6 +736,72 @@ TEST(vector, insertPosRange) {
   EXPECT_TRUE(equal(ft_vec, std_vec));
 }
 
+TEST(vector, append) {
+  const int src[] = {1, 2, 3, 4, 5};
+  std::vector<int> std_vec(3, 0);
+  ft::vector<int> ft_vec(3, 0);
+
+  std_vec.insert(std_vec.end(), src, src + 5);
+  ft_vec.append(src, 5);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::vector<int> std_cp(std_vec);
+  std_vec.insert(std_vec.end(), std_cp.begin(), std_cp.end());
+  ft_vec.append(&ft_vec[0], ft_vec.size());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::vector<std::string> std_str(2, "hello");
+  ft::vector<std::string> ft_str(2, "hello");
+  const std::string words[] = {"a", "b", "c"};
+  std_str.insert(std_str.end(), words, words + 3);
+  ft_str.append(words, 3);
+  EXPECT_TRUE(equal(ft_str, std_str));
+}
+
+TEST(vector, insertInputIterator) {
+  std::istringstream std_iss("1 2 3 4 5 6 7 8 9 10");
+  std::istringstream ft_iss("1 2 3 4 5 6 7 8 9 10");
+
+  std::vector<int> std_vec(3, 0);
+  ft::vector<int> ft_vec(3, 0);
+
+  std_vec.insert(std_vec.begin() + 1, std::istream_iterator<int>(std_iss),
+                 std::istream_iterator<int>());
+  ft_vec.insert(ft_vec.begin() + 1, std::istream_iterator<int>(ft_iss),
+                std::istream_iterator<int>());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::istringstream iss("5 4 3");
+  ft::vector<int> ft_vec2((std::istream_iterator<int>(iss)),
+                          std::istream_iterator<int>());
+  EXPECT_EQ(ft_vec2.size(), 3u);
+  EXPECT_EQ(ft_vec2[0], 5);
+  EXPECT_EQ(ft_vec2[2], 3);
+}
+
+TEST(vector, assignInputIterator) {
+  std::istringstream std_iss("a b c d");
+  std::istringstream ft_iss("a b c d");
+
+  std::vector<std::string> std_vec(10, "hello");
+  ft::vector<std::string> ft_vec(10, "hello");
+
+  std_vec.assign(std::istream_iterator<std::string>(std_iss),
+                 std::istream_iterator<std::string>());
+  ft_vec.assign(std::istream_iterator<std::string>(ft_iss),
+                std::istream_iterator<std::string>());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std::vector<std::string> src(6, "world");
+  std_vec.assign(src.begin(), src.end());
+  ft_vec.assign(src.begin(), src.end());
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.assign(src.begin(), src.begin() + 2);
+  ft_vec.assign(src.begin(), src.begin() + 2);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
 TEST(vector, erasePos) {
   std::list<int> lst;
   for (size_t i = 0; i < 100; i++) {
@@ -814,6 +918,154 @@ TEST(vector, clear) {
   EXPECT_TRUE(equal(ft_vec, std_vec));
 }
 
+TEST(vector, shrinkToFit) {
+  std::vector<std::string> std_vec(1000, "hello");
+  ft::vector<std::string> ft_vec(1000, "hello");
+
+  std_vec.erase(std_vec.begin() + 10, std_vec.end());
+  ft_vec.erase(ft_vec.begin() + 10, ft_vec.end());
+  EXPECT_EQ(ft_vec.capacity(), 1000u);
+
+  ft_vec.shrink_to_fit();
+  EXPECT_EQ(ft_vec.capacity(), 10u);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  ft_vec.clear();
+  ft_vec.shrink_to_fit();
+  EXPECT_EQ(ft_vec.capacity(), 0u);
+  ft_vec.push_back("world");
+  EXPECT_EQ(ft_vec.back(), "world");
+}
+
+TEST(vector, shrinkFactor) {
+  std::vector<int> std_vec;
+  ft::vector<int> ft_vec;
+  ft_vec.set_shrink_factor(4);
+  EXPECT_EQ(ft_vec.shrink_factor(), 4u);
+
+  for (int i = 0; i < 1024; i++) {
+    std_vec.push_back(i);
+    ft_vec.push_back(i);
+  }
+  EXPECT_EQ(ft_vec.capacity(), 1024u);
+
+  for (int i = 0; i < 768; i++) {
+    std_vec.pop_back();
+    ft_vec.pop_back();
+  }
+  EXPECT_EQ(ft_vec.capacity(), 1024u);
+
+  std_vec.pop_back();
+  ft_vec.pop_back();
+  EXPECT_EQ(ft_vec.capacity(), 510u);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.push_back(1);
+  ft_vec.push_back(1);
+  EXPECT_EQ(ft_vec.capacity(), 510u);
+
+  std::vector<int>::iterator std_it =
+      std_vec.erase(std_vec.begin() + 1, std_vec.end() - 1);
+  ft::vector<int>::iterator ft_it =
+      ft_vec.erase(ft_vec.begin() + 1, ft_vec.end() - 1);
+  EXPECT_EQ(ft_vec.capacity(), 4u);
+  EXPECT_EQ(*ft_it, *std_it);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  ft_vec.clear();
+  EXPECT_EQ(ft_vec.capacity(), 0u);
+}
+
+TEST(vector, shrinkFactorHysteresis) {
+  ft::vector<int> ft_vec;
+  EXPECT_THROW(ft_vec.set_shrink_factor(1), std::invalid_argument);
+  EXPECT_THROW(ft_vec.set_shrink_factor(2), std::invalid_argument);
+  EXPECT_EQ(ft_vec.shrink_factor(), 0u);
+
+  ft_vec.set_shrink_factor(3);
+  for (int i = 0; i < 1024; i++) {
+    ft_vec.push_back(i);
+  }
+  while (ft_vec.capacity() == 1024u) {
+    ft_vec.pop_back();
+  }
+  size_t size = ft_vec.size();
+  size_t capacity = ft_vec.capacity();
+  EXPECT_LT(size, capacity);
+
+  for (int i = 0; i < 1200; i++) {
+    if (i % 2 == 0) {
+      ft_vec.pop_back();
+    } else {
+      ft_vec.push_back(i);
+    }
+    EXPECT_EQ(ft_vec.capacity(), capacity);
+  }
+  EXPECT_EQ(ft_vec.size(), size);
+}
+
+TEST(vector, shrinkFactorKeepsElements) {
+  std::vector<std::string> std_vec;
+  ft::vector<std::string> ft_vec;
+  ft_vec.set_shrink_factor(3);
+  for (int i = 0; i < 64; i++) {
+    std::string value(40, static_cast<char>('a' + i % 26));
+    std_vec.push_back(value);
+    ft_vec.push_back(value);
+  }
+  size_t capacity = ft_vec.capacity();
+
+  std_vec.erase(std_vec.begin() + 4, std_vec.end() - 4);
+  ft_vec.erase(ft_vec.begin() + 4, ft_vec.end() - 4);
+  EXPECT_LT(ft_vec.capacity(), capacity);
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+
+  std_vec.pop_back();
+  ft_vec.pop_back();
+  EXPECT_TRUE(equal(ft_vec, std_vec));
+}
+
+TEST(vector, shrinkFactorIsCopied) {
+  ft::vector<int> a(10, 1);
+  a.set_shrink_factor(4);
+
+  ft::vector<int> b(a);
+  EXPECT_EQ(b.shrink_factor(), 4u);
+
+  ft::vector<int> c;
+  c = a;
+  EXPECT_EQ(c.shrink_factor(), 4u);
+
+  ft::vector<int> d(3, 2);
+  a = d;
+  EXPECT_EQ(a.shrink_factor(), 0u);
+}
+
+struct DestroyCounter {
+  static int destroyed;
+  ~DestroyCounter() { destroyed++; }
+};
+int DestroyCounter::destroyed = 0;
+
+TEST(vector, destroyElements) {
+  ft::vector<DestroyCounter> ft_vec(10);
+  DestroyCounter::destroyed = 0;
+
+  ft_vec.erase(ft_vec.begin() + 2, ft_vec.begin() + 5);
+  EXPECT_EQ(DestroyCounter::destroyed, 3);
+  EXPECT_EQ(ft_vec.size(), 7u);
+
+  ft_vec.clear();
+  EXPECT_EQ(DestroyCounter::destroyed, 10);
+  EXPECT_TRUE(ft_vec.empty());
+
+  ft::vector<int> ft_int(1000, 1);
+  ft_int.erase(ft_int.begin() + 10, ft_int.end());
+  EXPECT_EQ(ft_int.size(), 10u);
+  ft_int.clear();
+  EXPECT_TRUE(ft_int.empty());
+}
+
 TEST(vector, swapNonMember) {
   std::list<int> lst;
   for (size_t i = 0; i < 100; i++) {
@@ -868,6 +1120,39 @@ TEST(vector, relationalOperator) {
   EXPECT_TRUE(ft_vec >= ft_vec);
 }
 
+TEST(vector, relationalOperatorIntegral) {
+  std::vector<int> std_vec(1000, 7);
+  std::vector<int> std_vec2(1000, 7);
+  ft::vector<int> ft_vec(1000, 7);
+  ft::vector<int> ft_vec2(1000, 7);
+  EXPECT_EQ(ft_vec == ft_vec2, std_vec == std_vec2);
+  EXPECT_EQ(ft_vec < ft_vec2, std_vec < std_vec2);
+
+  std_vec2[700] = -1;
+  ft_vec2[700] = -1;
+  EXPECT_EQ(ft_vec == ft_vec2, std_vec == std_vec2);
+  EXPECT_EQ(ft_vec < ft_vec2, std_vec < std_vec2);
+  EXPECT_EQ(ft_vec2 < ft_vec, std_vec2 < std_vec);
+
+  std_vec2[700] = 7;
+  ft_vec2[700] = 7;
+  std_vec2.pop_back();
+  ft_vec2.pop_back();
+  EXPECT_EQ(ft_vec == ft_vec2, std_vec == std_vec2);
+  EXPECT_EQ(ft_vec < ft_vec2, std_vec < std_vec2);
+  EXPECT_EQ(ft_vec2 < ft_vec, std_vec2 < std_vec);
+
+  std::vector<signed char> std_chars(300, 1);
+  std::vector<signed char> std_chars2(300, 1);
+  ft::vector<signed char> ft_chars(300, 1);
+  ft::vector<signed char> ft_chars2(300, 1);
+  std_chars2[299] = -1;
+  ft_chars2[299] = -1;
+  EXPECT_EQ(ft_chars == ft_chars2, std_chars == std_chars2);
+  EXPECT_EQ(ft_chars < ft_chars2, std_chars < std_chars2);
+  EXPECT_EQ(ft_chars2 < ft_chars, std_chars2 < std_chars);
+}
+
 TEST(vector, get_allocator) {
   {
     ft::vector<int> ft_vec;
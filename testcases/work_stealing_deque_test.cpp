@@ -0,0 +1,106 @@
+#include "work_stealing_deque.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(work_stealing_deque, ownerIsLifo) {
+  ft::work_stealing_deque<int> deque(4);
+  int out;
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop(out));
+  for (int i = 0; i < 100; i++) {
+    deque.push(i);
+  }
+  EXPECT_EQ(deque.size(), 100u);
+  EXPECT_EQ(deque.capacity(), 128u);
+
+  for (int i = 99; i >= 0; i--) {
+    EXPECT_TRUE(deque.pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_FALSE(deque.pop(out));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(work_stealing_deque, stealIsFifo) {
+  ft::work_stealing_deque<int> deque;
+  int out;
+
+  EXPECT_FALSE(deque.steal(out));
+  for (int i = 0; i < 10; i++) {
+    deque.push(i);
+  }
+  EXPECT_TRUE(deque.steal(out));
+  EXPECT_EQ(out, 0);
+  EXPECT_TRUE(deque.steal(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_TRUE(deque.pop(out));
+  EXPECT_EQ(out, 9);
+  EXPECT_EQ(deque.size(), 7u);
+}
+
+TEST(work_stealing_deque, pointers) {
+  int values[3] = {1, 2, 3};
+  ft::work_stealing_deque<int*> deque;
+  int* out;
+
+  for (int i = 0; i < 3; i++) {
+    deque.push(&values[i]);
+  }
+  EXPECT_TRUE(deque.steal(out));
+  EXPECT_EQ(out, &values[0]);
+  EXPECT_TRUE(deque.pop(out));
+  EXPECT_EQ(out, &values[2]);
+}
+
+TEST(work_stealing_deque, thieves) {
+  const long items = 200000;
+  const int thieves = 3;
+  ft::work_stealing_deque<long> deque(16);
+  std::atomic<long> taken(0);
+  std::atomic<long> sum(0);
+  std::vector<std::thread> workers;
+
+  for (int i = 0; i < thieves; i++) {
+    workers.push_back(std::thread([&]() {
+      long value;
+      while (taken.load() < items) {
+        if (deque.steal(value)) {
+          sum += value;
+          taken++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }));
+  }
+
+  long value;
+  long clobbered = 0;
+  for (long i = 0; i < items; i++) {
+    deque.push(i);
+    if (i % 3 != 0) continue;
+    value = -1;
+    if (deque.pop(value)) {
+      sum += value;
+      taken++;
+    } else if (value != -1) {
+      clobbered++;
+    }
+  }
+  while (deque.pop(value)) {
+    sum += value;
+    taken++;
+  }
+  for (int i = 0; i < thieves; i++) {
+    workers[i].join();
+  }
+
+  EXPECT_EQ(taken.load(), items);
+  EXPECT_EQ(sum.load(), items * (items - 1) / 2);
+  EXPECT_EQ(clobbered, 0);
+}